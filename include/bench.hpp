@@ -5,15 +5,35 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#ifdef BENCH_HAVE_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include "cache_state.hpp"
+#include "concurrency.hpp"
 #include "graphs.hpp"
 #include "demangle.hpp"
+#include "growth_vector.hpp"
+#include "heap_aging.hpp"
+#include "histogram.hpp"
+#include "thread_pool.hpp"
 
 // chrono typedefs
 
 using std::chrono::milliseconds;
 using std::chrono::microseconds;
+using std::chrono::nanoseconds;
 
 using Clock = std::chrono::high_resolution_clock;
 
@@ -34,30 +54,248 @@ inline static void run(Container &container, std::size_t size){
     run<Rest...>(container, size);
 }
 
+// measure the average duration of the test policies on a container of the given size
+
+template<typename Container,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+std::size_t measure(std::size_t size){
+    std::size_t duration = 0;
+
+    for(std::size_t i=0; i<REPEAT; ++i) {
+        auto container = CreatePolicy<Container>::make(size);
+        cache_state::prepare(container);
+
+        Clock::time_point t0 = Clock::now();
+
+        run<TestPolicy...>(container, size);
+
+        Clock::time_point t1 = Clock::now();
+        duration += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+    }
+
+    return duration / REPEAT;
+}
+
 // benchmarking procedure
 
 template<typename Container,
          typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy,
+         typename Sizes>
+void bench(const std::string& type, const Sizes &sizes){
+    // a serie for each cache mode
+    for(auto mode : cache_state::modes()) {
+        cache_state::select(mode);
+        aging::precondition();
+
+        // create an element to copy so the temporary creation
+        // and initialization will not be accounted in a benchmark
+        for(auto size : sizes) {
+            auto duration = measure<Container, DurationUnit, CreatePolicy, TestPolicy...>(size);
+            graphs::new_result(type + cache_state::suffix(mode), std::to_string(size), duration);
+        }
+    }
+
+    cache_state::select(cache_state::modes().front());
+    CreatePolicy<Container>::clean();
+}
+
+// per operation latency percentiles, in per mille, of the timed policies on a
+// container of the given size, in ns
+
+static const std::size_t latency_percentiles[] = {500, 990, 999, 1000};
+
+template<typename Container,
          template<class> class CreatePolicy,
          template<class> class ...TestPolicy>
-void bench(const std::string& type, const std::initializer_list<int> &sizes){
-    // create an element to copy so the temporary creation
-    // and initialization will not be accounted in a benchmark
+void bench_latency(const std::string& type, std::size_t size){
+    aging::precondition();
+
+    auto &histogram = latency::current();
+    histogram.reset();
+
+    measure<Container, microseconds, CreatePolicy, TestPolicy...>(size);
+
+    for(auto per_mille : latency_percentiles)
+        graphs::new_result(type, std::to_string(per_mille), latency::to_ns(histogram.percentile(per_mille)));
+
+    CreatePolicy<Container>::clean();
+}
+
+// hit rate of a cache policy for each capacity, in per mille of the requests,
+// the test policy counts its requests and its hits
+
+template<typename Container,
+         template<class> class CreatePolicy,
+         template<class> class TestPolicy,
+         typename Sizes>
+void bench_hit_rate(const std::string& type, const Sizes &sizes){
     for(auto size : sizes) {
-        std::size_t duration = 0;
+        auto container = CreatePolicy<Container>::make(size);
 
-        for(std::size_t i=0; i<REPEAT; ++i) {
-            auto container = CreatePolicy<Container>::make(size);
+        TestPolicy<Container>::requests = 0;
+        TestPolicy<Container>::hits = 0;
+        TestPolicy<Container>::run(container, size);
 
-            Clock::time_point t0 = Clock::now();
+        auto requests = TestPolicy<Container>::requests;
+        graphs::new_result(type, std::to_string(size), requests ? TestPolicy<Container>::hits * 1000 / requests : 0);
+    }
 
-            run<TestPolicy...>(container, size);
+    CreatePolicy<Container>::clean();
+}
 
-            Clock::time_point t1 = Clock::now();
-            duration += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+// storage statistics of the growth vectors during a single run of the test
+// policies: peak memory in KB and share of the growths done in place
+
+template<typename Container,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+growth::statistics measure_growth(std::size_t size){
+    auto container = CreatePolicy<Container>::make(size);
+
+    auto &stats = growth::current();
+    stats = growth::statistics();
+    run<TestPolicy...>(container, size);
+
+    return stats;
+}
+
+enum class growth_statistic {
+    PEAK_MEMORY,
+    IN_PLACE
+};
+
+template<typename Container,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy,
+         typename Sizes>
+void bench_growth_statistic(growth_statistic statistic, const std::string& type, const Sizes &sizes){
+    for(auto size : sizes) {
+        auto stats = measure_growth<Container, CreatePolicy, TestPolicy...>(size);
+
+        if(statistic == growth_statistic::PEAK_MEMORY){
+            graphs::new_result(type, std::to_string(size), stats.peak / 1024);
+        } else {
+            graphs::new_result(type, std::to_string(size), stats.growths ? stats.in_place * 100 / stats.growths : 0);
         }
+    }
+
+    CreatePolicy<Container>::clean();
+}
+
+// number of threads used by the parallel policies
+
+inline void set_threads(std::size_t threads){
+    parallel::thread_pool::instance().resize(threads);
 
-        graphs::new_result(type, std::to_string(size), duration / REPEAT);
+#ifdef BENCH_HAVE_TBB
+    static std::unique_ptr<tbb::global_control> control;
+    control.reset();
+    control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, threads);
+#endif
+}
+
+// powers of two up to the number of cores, or the list in BENCH_THREADS (i.e. 1:2:4:8)
+
+inline std::vector<std::size_t> thread_counts(){
+    std::vector<std::size_t> threads;
+
+    if(const char *env = getenv("BENCH_THREADS")){
+        std::stringstream list(env);
+        std::string segment;
+        while(std::getline(list, segment, ':'))
+            if(std::atoi(segment.c_str()) > 0)
+                threads.push_back(std::atoi(segment.c_str()));
+    }
+
+    if(threads.empty()){
+        std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        for(std::size_t n = 1; n < cores; n *= 2)
+            threads.push_back(n);
+        threads.push_back(cores);
+    }
+
+    return threads;
+}
+
+// benchmarking procedure on a fixed size, sweeping the number of threads
+
+template<typename Container,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+std::vector<std::size_t> bench_threads(const std::string& type, std::size_t size, const std::vector<std::size_t> &threads){
+    std::vector<std::size_t> durations;
+
+    aging::precondition();
+
+    for(auto n : threads) {
+        set_threads(n);
+        durations.push_back(measure<Container, DurationUnit, CreatePolicy, TestPolicy...>(size));
+        graphs::new_result(type, std::to_string(n), durations.back());
+    }
+
+    set_threads(1);
+    CreatePolicy<Container>::clean();
+
+    return durations;
+}
+
+// each thread creates its own container, then all of them run the test
+// policies and destroy the containers at once. With remote set, containers
+// are destroyed by the next thread instead of the one which filled them. The
+// duration, in ns, covers the tests and the destructions.
+
+template<typename Container,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+std::size_t measure_concurrent(std::size_t threads, std::size_t size, bool remote){
+    using Created = decltype(CreatePolicy<Container>::make(size));
+
+    std::size_t duration = 0;
+
+    for(std::size_t i=0; i<REPEAT; ++i) {
+        std::vector<std::optional<Created>> containers(threads);
+        std::vector<Clock::time_point> ends(threads);
+        Clock::time_point t0;
+
+        concurrency::barrier barrier(threads);
+        concurrency::run_threads(threads, [&](std::size_t id){
+            containers[id].emplace(CreatePolicy<Container>::make(size));
+
+            barrier.arrive_and_wait();
+            if(id == 0)
+                t0 = Clock::now();
+
+            run<TestPolicy...>(*containers[id], size);
+
+            if(remote)
+                barrier.arrive_and_wait();
+
+            containers[remote ? (id + 1) % threads : id].reset();
+            ends[id] = Clock::now();
+        });
+
+        duration += std::chrono::duration_cast<std::chrono::nanoseconds>(*std::max_element(ends.begin(), ends.end()) - t0).count();
+    }
+
+    return duration / REPEAT;
+}
+
+// aggregate throughput of measure_concurrent(), in thousands of elements per second
+
+template<typename Container,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_concurrent(const std::string& type, std::size_t size, const std::vector<std::size_t> &threads, bool remote = false){
+    aging::precondition();
+
+    for(auto n : threads) {
+        auto duration = measure_concurrent<Container, CreatePolicy, TestPolicy...>(n, size, remote);
+        graphs::new_result(type, std::to_string(n), duration ? n * size * 1000000 / duration : 0);
     }
 
     CreatePolicy<Container>::clean();
@@ -98,7 +336,163 @@ std::string tag(std::string name){
 }
 
 template<typename T>
-void new_graph(const std::string &testName, const std::string &unit){
+void new_graph(const std::string &testName, const std::string &unit, const std::string &h_title = "Number of elements"){
     std::string title(testName + " - " + demangle(typeid(T).name()));
-    graphs::new_graph(tag(title), title, unit);
+    graphs::new_graph(tag(title), title, unit, h_title);
+}
+
+// benchmarking procedure repeated for each number of threads, one serie each
+
+template<typename Container,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_per_threads(const std::string& type, const std::initializer_list<int> &sizes, const std::vector<std::size_t> &threads){
+    for(auto n : threads) {
+        set_threads(n);
+        bench<Container, DurationUnit, CreatePolicy, TestPolicy...>(type + " " + std::to_string(n) + (n == 1 ? " thread" : " threads"), sizes);
+    }
+
+    set_threads(1);
+}
+
+// speedup and efficiency graphs of bench_threads() series, relative to their
+// run with the smallest number of threads
+
+using scaling_series = std::vector<std::pair<std::string, std::vector<std::size_t>>>;
+
+template<typename T>
+void scaling_graphs(const std::string &testName, const std::vector<std::size_t> &threads, const scaling_series &series){
+    new_graph<T>(testName + " speedup", "%", "Number of threads");
+    for(auto &serie : series)
+        for(std::size_t i = 0; i < threads.size(); ++i)
+            graphs::new_result(serie.first, std::to_string(threads[i]),
+                serie.second[i] ? serie.second.front() * 100 / serie.second[i] : 0);
+
+    new_graph<T>(testName + " efficiency", "%", "Number of threads");
+    for(auto &serie : series)
+        for(std::size_t i = 0; i < threads.size(); ++i)
+            graphs::new_result(serie.first, std::to_string(threads[i]),
+                serie.second[i] ? serie.second.front() * threads.front() * 100 / (serie.second[i] * threads[i]) : 0);
+}
+
+// producer/consumer benchmarking procedure: producers push items stamped with
+// the time of the push, consumers record how long each item stayed queued
+
+static const std::size_t queue_capacity = 4096;
+static const std::size_t queue_percentiles[] = {500, 990, 999};
+
+struct queue_result {
+    std::string config;                     // producers x consumers
+    std::size_t throughput = 0;             // thousands of items per second
+    std::vector<std::size_t> latencies;     // ns, one per queue_percentiles
+};
+
+using queue_series = std::vector<std::pair<std::string, std::vector<queue_result>>>;
+
+template<typename Queue>
+queue_result measure_queue(std::size_t producers, std::size_t consumers, std::size_t items){
+    using T = typename Queue::value_type;
+
+    // pushed once per consumer by the last producer
+    static const std::size_t stop = std::numeric_limits<std::size_t>::max();
+
+    queue_result result;
+    result.config = std::to_string(producers) + "x" + std::to_string(consumers);
+    result.latencies.resize(std::size(queue_percentiles));
+
+    std::uint64_t duration = 0;
+
+    for(std::size_t i=0; i<REPEAT; ++i) {
+        Queue queue(queue_capacity);
+        std::atomic<std::size_t> running{producers};
+
+        std::vector<std::vector<std::uint64_t>> samples(consumers);
+        for(auto &s : samples)
+            s.reserve(items / consumers + 1);
+
+        duration += concurrency::run_threads(producers + consumers, [&](std::size_t id){
+            if(id < producers){
+                T value{};
+                std::size_t count = items / producers + (id < items % producers);
+                for(std::size_t j = 0; j < count; ++j){
+                    value.a = concurrency::now();
+                    while(!queue.try_push(value)){
+                        std::this_thread::yield();
+                        value.a = concurrency::now();
+                    }
+                }
+
+                if(running.fetch_sub(1, std::memory_order_acq_rel) == 1){
+                    value.a = stop;
+                    for(std::size_t j = 0; j < consumers; ++j)
+                        while(!queue.try_push(value))
+                            std::this_thread::yield();
+                }
+            } else {
+                auto &latencies = samples[id - producers];
+                T value{};
+                while(true){
+                    if(!queue.try_pop(value)){
+                        std::this_thread::yield();
+                    } else if(value.a == stop){
+                        break;
+                    } else {
+                        latencies.push_back(concurrency::now() - value.a);
+                    }
+                }
+            }
+        });
+
+        std::vector<std::uint64_t> all;
+        all.reserve(items);
+        for(auto &s : samples)
+            all.insert(all.end(), s.begin(), s.end());
+
+        for(std::size_t p = 0; p < std::size(queue_percentiles); ++p)
+            result.latencies[p] += concurrency::percentile(all, queue_percentiles[p]) / REPEAT;
+    }
+
+    duration /= REPEAT;
+    result.throughput = duration ? items * 1000000 / duration : 0;
+
+    return result;
+}
+
+template<typename Queue>
+std::vector<queue_result> bench_queue(const std::vector<std::pair<std::size_t, std::size_t>> &configs, std::size_t items){
+    std::vector<queue_result> results;
+
+    aging::precondition();
+
+    // configurations not supported by the queue are skipped
+    for(auto &config : configs) {
+        if((config.first > 1 && !Queue::multi_producer) || (config.second > 1 && !Queue::multi_consumer))
+            continue;
+
+        results.push_back(measure_queue<Queue>(config.first, config.second, items));
+    }
+
+    return results;
+}
+
+// throughput graph and one latency graph per percentile of bench_queue() series
+
+inline std::string per_mille_name(std::size_t per_mille){
+    return per_mille % 10 ? std::to_string(per_mille / 10) + "." + std::to_string(per_mille % 10) : std::to_string(per_mille / 10);
+}
+
+template<typename T>
+void queue_graphs(const std::string &testName, const queue_series &series){
+    new_graph<T>(testName + " throughput", "Kitems/s", "Producers x consumers");
+    for(auto &serie : series)
+        for(auto &result : serie.second)
+            graphs::new_result(serie.first, result.config, result.throughput);
+
+    for(std::size_t p = 0; p < std::size(queue_percentiles); ++p) {
+        new_graph<T>(testName + " p" + per_mille_name(queue_percentiles[p]) + " latency", "ns", "Producers x consumers");
+        for(auto &serie : series)
+            for(auto &result : serie.second)
+                graphs::new_result(serie.first, result.config, result.latencies[p]);
+    }
 }
@@ -0,0 +1,148 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CACHE_STATE
+#define ARTICLES_CACHE_STATE
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "demangle.hpp"
+
+// State of the CPU caches when the timer starts, after the creation of the
+// container. By default the container is timed as built, often still in the
+// cache. Otherwise, it is either:
+//
+//     cold      evicted by writing a buffer twice as large as the last level
+//               cache
+//     clflush   flushed with clflush, element by element (x86 only, cold
+//               elsewhere)
+//     warm      walked once, so that its elements are in the cache
+//     both      cold and warm, as two series suffixed by " cold" and " warm"
+//
+// The containers walked neither by iterators nor by index are evicted with
+// the buffer by clflush and are left as built by warm, with a warning.
+
+namespace cache_state {
+
+enum class mode {
+    AS_BUILT,
+    COLD,
+    CLFLUSH,
+    WARM
+};
+
+// Set the modes from "cold", "warm", "both" or "clflush", nothing or "off"
+// keeps the containers as built
+void configure(const char *spec);
+
+// The modes of the series, the other measurements use the first one
+const std::vector<mode> &modes();
+
+// Suffix of the series measured in the given mode, when there are several
+std::string suffix(mode m);
+
+void select(mode m);
+mode current();
+
+// Write the eviction buffer
+void evict();
+
+// Flush the cache lines of the given bytes, then wait for the flushes with
+// fence()
+void flush(const void *address, std::size_t bytes);
+void fence();
+
+// Read the cache lines of the given bytes
+void touch(const void *address, std::size_t bytes);
+
+// Warn, once per container and mode, that the container cannot be walked
+void unwalkable(const std::string &container, mode m);
+
+template<typename Container, typename = void>
+struct is_iterable : std::false_type {};
+
+template<typename Container>
+struct is_iterable<Container, std::void_t<decltype(std::begin(std::declval<Container &>()))>> : std::true_type {};
+
+template<typename Container, typename = void>
+struct is_indexable : std::false_type {};
+
+template<typename Container>
+struct is_indexable<Container, std::void_t<decltype(std::declval<Container &>().size()), decltype(std::declval<Container &>()[std::size_t()])>> : std::true_type {};
+
+// Flush or touch the elements of the container, false when it can be walked
+// neither by iterators nor by index
+template<typename Container>
+bool walk(Container &c, mode m){
+    auto visit = [m](auto &value){
+        if(m == mode::CLFLUSH){
+            flush(std::addressof(value), sizeof(value));
+        } else {
+            touch(std::addressof(value), sizeof(value));
+        }
+    };
+
+    if constexpr (is_iterable<Container>::value) {
+        for(auto &value : c){
+            visit(value);
+        }
+        return true;
+    } else if constexpr (is_indexable<Container>::value) {
+        for(std::size_t i = 0; i < c.size(); ++i){
+            visit(c[i]);
+        }
+        return true;
+    } else {
+        (void) c;
+        (void) visit;
+        return false;
+    }
+}
+
+// The source and the optional target of the copies and moves
+template<typename Container, typename Target>
+bool walk(std::pair<Container, std::optional<Target>> &p, mode m){
+    return walk(p.first, m) && (!p.second || walk(*p.second, m));
+}
+
+// Put the container in the state of the current mode
+template<typename Container>
+void prepare(Container &c){
+    auto m = current();
+    if(m == mode::AS_BUILT){
+        return;
+    }
+
+    if(m == mode::COLD){
+        evict();
+        return;
+    }
+
+    if(walk(c, m)){
+        if(m == mode::CLFLUSH){
+            fence();
+        }
+        return;
+    }
+
+    unwalkable(demangle(typeid(Container).name()), m);
+    if(m == mode::CLFLUSH){
+        evict();
+    }
+}
+
+} //end of namespace cache_state
+
+#endif
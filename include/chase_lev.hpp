@@ -0,0 +1,173 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CHASE_LEV
+#define ARTICLES_CHASE_LEV
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Work-stealing deques: the owner thread pushes and pops at the bottom while
+// the other threads steal from the top
+
+namespace parallel {
+
+// std::deque behind a lock, as in the queues of the thread pool
+template<typename T>
+class locked_deque {
+    public:
+        void push(const T &value){
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(value);
+        }
+
+        bool pop(T &value){
+            std::lock_guard<std::mutex> lock(mutex);
+            if(tasks.empty()){
+                return false;
+            }
+
+            value = tasks.back();
+            tasks.pop_back();
+            return true;
+        }
+
+        bool steal(T &value){
+            std::lock_guard<std::mutex> lock(mutex);
+            if(tasks.empty()){
+                return false;
+            }
+
+            value = tasks.front();
+            tasks.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex mutex;
+        std::deque<T> tasks;
+};
+
+// Lock-free Chase-Lev deque, with the memory orderings of "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (Le et al., PPoPP 2013).
+// The owner only synchronizes with the thieves when the deque is about to be
+// empty, the buffer grows on demand and the old ones are kept until the
+// destruction since thieves may still read from them.
+template<typename T>
+class chase_lev_deque {
+    static_assert(std::is_trivially_copyable<T>::value, "The elements are read and written atomically");
+
+    public:
+        explicit chase_lev_deque(std::size_t capacity = 1024){
+            std::size_t size = 2;
+            while(size < capacity){
+                size *= 2;
+            }
+
+            buffers.push_back(std::make_unique<buffer>(size));
+            current.store(buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(const chase_lev_deque &) = delete;
+        chase_lev_deque &operator=(const chase_lev_deque &) = delete;
+
+        void push(const T &value){
+            auto b = bottom.load(std::memory_order_relaxed);
+            auto t = top.load(std::memory_order_acquire);
+            auto a = current.load(std::memory_order_relaxed);
+
+            if(b - t > static_cast<std::int64_t>(a->mask)){
+                a = grow(a, t, b);
+            }
+
+            a->put(b, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        bool pop(T &value){
+            auto b = bottom.load(std::memory_order_relaxed) - 1;
+            auto a = current.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto t = top.load(std::memory_order_relaxed);
+
+            if(t > b){
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            value = a->get(b);
+            if(t == b){
+                // last element, race against the thieves for it
+                bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            return true;
+        }
+
+        bool steal(T &value){
+            auto t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto b = bottom.load(std::memory_order_acquire);
+
+            if(t >= b){
+                return false;
+            }
+
+            auto a = current.load(std::memory_order_acquire);
+            value = a->get(t);
+            return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+    private:
+        struct buffer {
+            std::size_t mask;
+            std::unique_ptr<std::atomic<T>[]> slots;
+
+            explicit buffer(std::size_t size) : mask(size - 1), slots(new std::atomic<T>[size]) {}
+
+            T get(std::int64_t i) const {
+                return slots[i & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, const T &value){
+                slots[i & mask].store(value, std::memory_order_relaxed);
+            }
+        };
+
+        buffer *grow(buffer *a, std::int64_t t, std::int64_t b){
+            buffers.push_back(std::make_unique<buffer>(2 * (a->mask + 1)));
+            auto bigger = buffers.back().get();
+
+            for(auto i = t; i < b; ++i){
+                bigger->put(i, a->get(i));
+            }
+
+            current.store(bigger, std::memory_order_release);
+            return bigger;
+        }
+
+        alignas(64) std::atomic<std::int64_t> top{0};
+        alignas(64) std::atomic<std::int64_t> bottom{0};
+        alignas(64) std::atomic<buffer *> current;
+
+        // only touched by the owner
+        std::vector<std::unique_ptr<buffer>> buffers;
+};
+
+} //end of namespace parallel
+
+#endif
@@ -0,0 +1,115 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CONCURRENCY
+#define ARTICLES_CONCURRENCY
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Helpers for the benchmarks running their own threads, as opposed to the
+// fork-join ones running on the thread pool
+
+namespace concurrency {
+
+// nanoseconds on the steady clock, used to stamp elements
+inline std::uint64_t now(){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Holds the threads until all of them are started, so that their creation is
+// not part of the measure
+class start_gate {
+    public:
+        explicit start_gate(std::size_t threads) : waiting(threads) {}
+
+        void arrive_and_wait(){
+            waiting.fetch_sub(1, std::memory_order_acq_rel);
+            while(!opened.load(std::memory_order_acquire)){
+                std::this_thread::yield();
+            }
+        }
+
+        void open(){
+            while(waiting.load(std::memory_order_acquire)){
+                std::this_thread::yield();
+            }
+            opened.store(true, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<std::size_t> waiting;
+        std::atomic<bool> opened{false};
+};
+
+// Reusable barrier for a fixed number of threads
+class barrier {
+    public:
+        explicit barrier(std::size_t threads) : threads(threads) {}
+
+        void arrive_and_wait(){
+            auto phase = generation.load(std::memory_order_acquire);
+            if(waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == threads){
+                waiting.store(0, std::memory_order_relaxed);
+                generation.fetch_add(1, std::memory_order_release);
+                return;
+            }
+
+            while(generation.load(std::memory_order_acquire) == phase){
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        const std::size_t threads;
+        std::atomic<std::size_t> waiting{0};
+        std::atomic<std::size_t> generation{0};
+};
+
+// Run f(index) on n threads released together, returns the nanoseconds
+// between their release and the end of the last one
+template<typename Functor>
+std::uint64_t run_threads(std::size_t n, Functor f){
+    start_gate gate(n);
+
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < n; ++i){
+        threads.emplace_back([&gate, &f, i]{
+            gate.arrive_and_wait();
+            f(i);
+        });
+    }
+
+    gate.open();
+    auto t0 = now();
+
+    for(auto &thread : threads){
+        thread.join();
+    }
+
+    return now() - t0;
+}
+
+// Percentile, in per mille, of unsorted samples (which are reordered)
+inline std::uint64_t percentile(std::vector<std::uint64_t> &samples, std::size_t per_mille){
+    if(samples.empty()){
+        return 0;
+    }
+
+    auto rank = std::min(samples.size() - 1, samples.size() * per_mille / 1000);
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+    return samples[rank];
+}
+
+} //end of namespace concurrency
+
+#endif
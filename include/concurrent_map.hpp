@@ -0,0 +1,235 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_CONCURRENT_MAP
+#define ARTICLES_CONCURRENT_MAP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+
+// Maps shared between threads, from a key to a copy of an element. All of
+// them take the expected number of keys at construction and expose find(),
+// which copies the element out, and insert_or_assign().
+
+namespace maps {
+
+// murmur3 finalizer, so that consecutive keys are spread over the table
+inline std::size_t mix(std::size_t x){
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// std::unordered_map behind a single lock, readers share it when the mutex
+// is a std::shared_mutex
+template<typename T, typename Mutex>
+class locked_map {
+    public:
+        using value_type = T;
+
+        explicit locked_map(std::size_t capacity){
+            map.reserve(capacity);
+        }
+
+        locked_map(locked_map &&other) : map(std::move(other.map)) {}
+
+        bool find(std::size_t key, T &value){
+            if constexpr (std::is_same<Mutex, std::shared_mutex>::value) {
+                std::shared_lock<Mutex> lock(mutex);
+                return lookup(key, value);
+            } else {
+                std::lock_guard<Mutex> lock(mutex);
+                return lookup(key, value);
+            }
+        }
+
+        bool insert_or_assign(std::size_t key, const T &value){
+            std::lock_guard<Mutex> lock(mutex);
+            map.insert_or_assign(key, value);
+            return true;
+        }
+
+    private:
+        bool lookup(std::size_t key, T &value) const {
+            auto it = map.find(key);
+            if(it == map.end()){
+                return false;
+            }
+
+            value = it->second;
+            return true;
+        }
+
+        Mutex mutex;
+        std::unordered_map<std::size_t, T> map;
+};
+
+// Keys spread over independent std::unordered_map shards, each one with its
+// own lock on its own cache line
+template<typename T, std::size_t Shards = 64>
+class striped_map {
+    public:
+        using value_type = T;
+
+        explicit striped_map(std::size_t capacity) : shards(new shard[Shards]) {
+            for(std::size_t i = 0; i < Shards; ++i){
+                shards[i].map.reserve(capacity / Shards + 1);
+            }
+        }
+
+        bool find(std::size_t key, T &value){
+            auto &s = shard_of(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
+
+            auto it = s.map.find(key);
+            if(it == s.map.end()){
+                return false;
+            }
+
+            value = it->second;
+            return true;
+        }
+
+        bool insert_or_assign(std::size_t key, const T &value){
+            auto &s = shard_of(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.map.insert_or_assign(key, value);
+            return true;
+        }
+
+    private:
+        struct alignas(64) shard {
+            std::mutex mutex;
+            std::unordered_map<std::size_t, T> map;
+        };
+
+        shard &shard_of(std::size_t key){
+            // the high bits, the map itself uses the low ones
+            return shards[(mix(key) >> 32) % Shards];
+        }
+
+        std::unique_ptr<shard[]> shards;
+};
+
+// Lock-free open addressing with linear probing and a fixed capacity of twice
+// the expected number of keys, keys are never removed. A key is claimed with
+// a CAS on an empty slot, then its value is protected by a per-slot version
+// as in a seqlock: writers make it odd while they write, readers copy the
+// value and retry if the version changed meanwhile.
+template<typename T>
+class open_addressing_map {
+    static_assert(std::is_trivially_copyable<T>::value, "The values are copied optimistically");
+
+    public:
+        using value_type = T;
+
+        explicit open_addressing_map(std::size_t capacity){
+            std::size_t size = 2;
+            while(size < 2 * capacity){
+                size *= 2;
+            }
+
+            mask = size - 1;
+            slots.reset(new slot[size]);
+        }
+
+        bool find(std::size_t key, T &value){
+            auto i = mix(key) & mask;
+            for(std::size_t probes = 0; probes <= mask; ++probes, i = (i + 1) & mask){
+                auto current = slots[i].key.load(std::memory_order_acquire);
+                if(current == empty){
+                    return false;
+                }
+
+                if(current == key){
+                    return read(slots[i], value);
+                }
+            }
+
+            return false;
+        }
+
+        bool insert_or_assign(std::size_t key, const T &value){
+            auto i = mix(key) & mask;
+            for(std::size_t probes = 0; probes <= mask; ++probes, i = (i + 1) & mask){
+                auto current = slots[i].key.load(std::memory_order_acquire);
+                if(current == empty && slots[i].key.compare_exchange_strong(current, key, std::memory_order_acq_rel)){
+                    current = key;
+                }
+
+                if(current == key){
+                    write(slots[i], value);
+                    return true;
+                }
+            }
+
+            // the table is full
+            return false;
+        }
+
+    private:
+        static constexpr std::size_t empty = std::numeric_limits<std::size_t>::max();
+
+        struct slot {
+            std::atomic<std::size_t> key{empty};
+            std::atomic<std::uint64_t> version{0};  // 0 until the first write
+            T value;
+        };
+
+        static bool read(slot &s, T &value){
+            while(true){
+                auto before = s.version.load(std::memory_order_acquire);
+                if(!before){
+                    // claimed but not yet written
+                    return false;
+                }
+
+                if(before & 1){
+                    continue;
+                }
+
+                value = s.value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if(s.version.load(std::memory_order_relaxed) == before){
+                    return true;
+                }
+            }
+        }
+
+        static void write(slot &s, const T &value){
+            auto version = s.version.load(std::memory_order_relaxed);
+            while(true){
+                if(!(version & 1) && s.version.compare_exchange_weak(version, version + 1, std::memory_order_acquire)){
+                    break;
+                }
+
+                version = s.version.load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_release);
+            s.value = value;
+            s.version.store(version + 2, std::memory_order_release);
+        }
+
+        std::size_t mask;
+        std::unique_ptr<slot[]> slots;
+};
+
+} //end of namespace maps
+
+#endif
@@ -0,0 +1,155 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_DISTRIBUTIONS
+#define ARTICLES_DISTRIBUTIONS
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+
+// Distributions of the keys looked up, erased or inserted by the policies,
+// selected for the whole run with BENCH_DIST:
+//
+//     uniform         all the keys are equally likely
+//     zipf:s          key k (from 0) is drawn with a probability in 1/(k+1)^s
+//     hotspot:h       90% of the draws go to the first h * n keys
+//     window:w        uniform in a window of w * n keys moving by one key on
+//                     each draw, so recent keys are drawn again soon
+//
+// Without BENCH_DIST the policies keep their own keys.
+
+namespace distributions {
+
+enum class kind {
+    UNIFORM,
+    ZIPF,
+    HOTSPOT,
+    WINDOW
+};
+
+struct config {
+    bool enabled = false;
+    kind distribution = kind::UNIFORM;
+    double parameter = 0.0;
+    std::string name;
+};
+
+config parse(const char *spec);
+void configure(const char *spec);
+const config &current();
+
+inline bool enabled(){
+    return current().enabled;
+}
+
+// Draws keys in [0, n) following the configured distribution, or the given
+// one which must outlive the generator
+class generator {
+    public:
+        explicit generator(std::size_t n, unsigned seed = 0) : generator(current(), n, seed) {}
+
+        generator(const config &settings, std::size_t n, unsigned seed = 0) :
+                settings(settings), n(n ? n : 1), engine(seed), window(std::clamp<std::size_t>(settings.parameter * this->n, 1, this->n)) {
+            if(settings.distribution == kind::ZIPF){
+                exponent = settings.parameter;
+                integral_x1 = h_integral(1.5) - 1.0;
+                integral_n = h_integral(this->n + 0.5);
+                s = 2.0 - h_integral_inverse(h_integral(2.5) - h(2.0));
+            }
+        }
+
+        std::size_t operator()(){
+            switch(settings.distribution){
+                case kind::ZIPF:
+                    return zipf() - 1;
+                case kind::HOTSPOT: {
+                    std::size_t hot = std::max<std::size_t>(1, settings.parameter * n);
+                    if(unit(engine) < 0.9){
+                        return std::uniform_int_distribution<std::size_t>(0, hot - 1)(engine);
+                    }
+                    return std::uniform_int_distribution<std::size_t>(0, n - 1)(engine);
+                }
+                case kind::WINDOW: {
+                    auto key = (offset + std::uniform_int_distribution<std::size_t>(0, window - 1)(engine)) % n;
+                    offset = (offset + 1) % n;
+                    return key;
+                }
+                case kind::UNIFORM:
+                default:
+                    return std::uniform_int_distribution<std::size_t>(0, n - 1)(engine);
+            }
+        }
+
+    private:
+        // Rejection-inversion sampling (Hormann and Derflinger), constant
+        // time without any table, returns a rank in [1, n]
+        std::size_t zipf(){
+            while(true){
+                double u = integral_n + unit(engine) * (integral_x1 - integral_n);
+                double x = h_integral_inverse(u);
+
+                auto k = static_cast<std::size_t>(x + 0.5);
+                if(k < 1){
+                    k = 1;
+                } else if(k > n){
+                    k = n;
+                }
+
+                if(k - x <= s || u >= h_integral(k + 0.5) - h(k)){
+                    return k;
+                }
+            }
+        }
+
+        double h(double x) const {
+            return std::exp(-exponent * std::log(x));
+        }
+
+        double h_integral(double x) const {
+            double log_x = std::log(x);
+            return helper2((1.0 - exponent) * log_x) * log_x;
+        }
+
+        double h_integral_inverse(double x) const {
+            double t = x * (1.0 - exponent);
+            if(t < -1.0){
+                t = -1.0;
+            }
+            return std::exp(helper1(t) * x);
+        }
+
+        // log(1 + x) / x and (exp(x) - 1) / x, accurate around 0
+        static double helper1(double x){
+            return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+        }
+
+        static double helper2(double x){
+            return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+        }
+
+        const config &settings;
+        const std::size_t n;
+        std::mt19937_64 engine;
+        std::uniform_real_distribution<double> unit;
+
+        // zipf
+        double exponent = 0.0;
+        double integral_x1 = 0.0;
+        double integral_n = 0.0;
+        double s = 0.0;
+
+        // moving window
+        std::size_t window;
+        std::size_t offset = 0;
+};
+
+} //end of namespace distributions
+
+#endif
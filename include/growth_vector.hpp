@@ -0,0 +1,259 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_GROWTH_VECTOR
+#define ARTICLES_GROWTH_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Vector with a configurable growth factor (Num / Den) and way of growing its
+// storage:
+//
+//     COPY      new storage, the elements are moved, as std::vector does
+//     REALLOC   realloc(), which may extend the block in place
+//     MREMAP    realloc() for small buffers, then mmap() and mremap(), so the
+//               pages are moved to a bigger mapping instead of being copied
+//
+// realloc() and mremap() only work for trivially copyable types.
+
+namespace growth {
+
+enum class method {
+    COPY,
+    REALLOC,
+    MREMAP
+};
+
+// Buffers from this size are mapped by the MREMAP vectors
+static constexpr std::size_t mremap_threshold = std::size_t(1) << 20;
+
+// Storage of all the growth vectors, the peak counts the old and the new
+// buffers of a growth as long as both exist
+struct statistics {
+    std::size_t live = 0;
+    std::size_t peak = 0;
+    std::size_t growths = 0;
+    std::size_t in_place = 0;   // growths keeping the address of the buffer
+
+    void allocated(std::size_t bytes){
+        live += bytes;
+        peak = std::max(peak, live);
+    }
+
+    void released(std::size_t bytes){
+        live -= bytes;
+    }
+};
+
+inline statistics &current(){
+    static statistics s;
+    return s;
+}
+
+template<typename T, std::size_t Num, std::size_t Den, method Method = method::COPY>
+class growth_vector {
+    static_assert(Num > Den, "The vector must grow");
+    static_assert(Method == method::COPY || std::is_trivially_copyable<T>::value,
+        "realloc() and mremap() only work for trivially copyable types");
+
+    public:
+        using value_type = T;
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        growth_vector() = default;
+
+        growth_vector(const growth_vector &) = delete;
+        growth_vector &operator=(const growth_vector &) = delete;
+
+        growth_vector(growth_vector &&other) noexcept : data(other.data), count(other.count), allocated(other.allocated) {
+            other.data = nullptr;
+            other.count = 0;
+            other.allocated = 0;
+        }
+
+        growth_vector &operator=(growth_vector &&other) noexcept {
+            std::swap(data, other.data);
+            std::swap(count, other.count);
+            std::swap(allocated, other.allocated);
+            return *this;
+        }
+
+        ~growth_vector(){
+            clear();
+            release(data, allocated);
+        }
+
+        std::size_t size() const { return count; }
+        std::size_t capacity() const { return allocated; }
+        bool empty() const { return !count; }
+
+        iterator begin(){ return data; }
+        iterator end(){ return data + count; }
+        const_iterator begin() const { return data; }
+        const_iterator end() const { return data + count; }
+
+        T &operator[](std::size_t i){ return data[i]; }
+        const T &operator[](std::size_t i) const { return data[i]; }
+
+        void reserve(std::size_t n){
+            if(n > allocated){
+                reallocate(n);
+            }
+        }
+
+        void push_back(const T &value){
+            emplace_back(value);
+        }
+
+        void push_back(T &&value){
+            emplace_back(std::move(value));
+        }
+
+        template<typename... Args>
+        T &emplace_back(Args&&... args){
+            if(count == allocated){
+                // the arguments may refer to the current elements
+                T value(std::forward<Args>(args)...);
+                reallocate(std::max(allocated + 1, allocated * Num / Den));
+                new (data + count) T(std::move(value));
+            } else {
+                new (data + count) T(std::forward<Args>(args)...);
+            }
+
+            return data[count++];
+        }
+
+        void clear(){
+            std::destroy(data, data + count);
+            count = 0;
+        }
+
+    private:
+        static bool mapped(std::size_t n){
+#ifdef __linux__
+            return Method == method::MREMAP && n * sizeof(T) >= mremap_threshold;
+#else
+            return false;
+#endif
+        }
+
+        void reallocate(std::size_t n){
+            auto &stats = current();
+            if(allocated){
+                ++stats.growths;
+            }
+
+            if constexpr (Method == method::COPY) {
+                auto storage = std::allocator<T>().allocate(n);
+                stats.allocated(n * sizeof(T));
+
+                for(std::size_t i = 0; i < count; ++i){
+                    new (storage + i) T(std::move_if_noexcept(data[i]));
+                }
+
+                std::destroy(data, data + count);
+                release(data, allocated);
+                data = storage;
+            } else {
+#ifdef __linux__
+                if(mapped(n)){
+                    static const std::size_t page = sysconf(_SC_PAGESIZE);
+                    auto bytes = (n * sizeof(T) + page - 1) / page * page;
+                    auto capacity = bytes / sizeof(T);
+
+                    void *storage;
+                    if(mapped(allocated)){
+                        storage = mremap(data, allocated * sizeof(T), bytes, MREMAP_MAYMOVE);
+                        if(storage == MAP_FAILED){
+                            throw std::bad_alloc();
+                        }
+
+                        // the pages are moved, never copied
+                        stats.released(allocated * sizeof(T));
+                        stats.allocated(capacity * sizeof(T));
+                        stats.in_place += storage == data;
+                    } else {
+                        storage = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                        if(storage == MAP_FAILED){
+                            throw std::bad_alloc();
+                        }
+
+                        stats.allocated(capacity * sizeof(T));
+                        if(count){
+                            std::memcpy(storage, data, count * sizeof(T));
+                        }
+                        release(data, allocated);
+                    }
+
+                    data = static_cast<T *>(storage);
+                    allocated = capacity;
+                    return;
+                }
+#endif
+
+                auto storage = static_cast<T *>(std::realloc(data, n * sizeof(T)));
+                if(!storage){
+                    throw std::bad_alloc();
+                }
+
+                if(data && storage == data){
+                    stats.released(allocated * sizeof(T));
+                    stats.allocated(n * sizeof(T));
+                    ++stats.in_place;
+                } else {
+                    // realloc() may have copied the block, both are counted
+                    stats.allocated(n * sizeof(T));
+                    stats.released(allocated * sizeof(T));
+                }
+
+                data = storage;
+            }
+
+            allocated = n;
+        }
+
+        static void release(T *storage, std::size_t n){
+            if(!storage){
+                return;
+            }
+
+            current().released(n * sizeof(T));
+
+            if constexpr (Method == method::COPY) {
+                std::allocator<T>().deallocate(storage, n);
+            } else {
+#ifdef __linux__
+                if(mapped(n)){
+                    munmap(storage, n * sizeof(T));
+                    return;
+                }
+#endif
+                std::free(storage);
+            }
+        }
+
+        T *data = nullptr;
+        std::size_t count = 0;
+        std::size_t allocated = 0;
+};
+
+} //end of namespace growth
+
+#endif
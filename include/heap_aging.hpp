@@ -0,0 +1,63 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_HEAP_AGING
+#define ARTICLES_HEAP_AGING
+
+#include <cstddef>
+#include <string>
+
+// Heap pre-conditioning, so that the benchmarks run on an allocator in a
+// steady state instead of a pristine one.
+//
+// Before each serie the allocator is churned with blocks of random sizes and
+// lifetimes: most blocks are short-lived and are freed by the end of the
+// churn, leaving holes behind, while a few of them replace blocks of a
+// long-lived set that survives for the whole run.
+
+namespace aging {
+
+enum class sizes {
+    UNIFORM,    // uniform between min and max
+    LOG,        // log-uniform between min and max, small blocks dominate
+    POW2        // powers of two between min and max
+};
+
+struct config {
+    bool enabled = false;
+    std::size_t churn = 1000000;    // allocations per serie
+    std::size_t live = 100000;      // blocks of the long-lived set
+    std::size_t lifetime = 1000;    // average lifetime of short-lived blocks, in allocations
+    std::size_t long_lived = 1;     // percentage of allocations going to the long-lived set
+    std::size_t min_size = 16;
+    std::size_t max_size = 4096;
+    sizes distribution = sizes::LOG;
+};
+
+struct heap_stats {
+    bool available = false;
+    std::size_t arena = 0;          // bytes obtained from the system
+    std::size_t in_use = 0;         // bytes allocated
+    std::size_t free = 0;           // bytes free in the arena
+};
+
+// Enable aging from a specification such as "on" (defaults) or
+// "churn=2000000,live=50000,lifetime=500,long=2,min=16,max=65536,sizes=pow2"
+void configure(const char *spec);
+const config &current();
+
+// Churn the allocator, if aging is enabled
+void precondition();
+
+heap_stats stats();
+
+// Free bytes in the arena over the bytes obtained from the system, in percent
+std::size_t fragmentation(const heap_stats &stats);
+
+} //end of namespace aging
+
+#endif
@@ -0,0 +1,352 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_HEAPS
+#define ARTICLES_HEAPS
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Min-heaps ordered by operator< on the elements, with the interface of
+// std::priority_queue (push, pop, top, empty, size) and a range constructor
+// building the heap at once
+
+namespace heaps {
+
+// std::priority_queue is a max-heap, this makes it a min-heap with only
+// operator< on the elements
+struct greater {
+    template<typename T>
+    bool operator()(const T &lhs, const T &rhs) const {
+        return rhs < lhs;
+    }
+};
+
+// Implicit heap with D children per node: the heap is shallower than a binary
+// one and the children of a node are contiguous, so each level of a sift
+// down touches fewer cache lines
+template<typename T, std::size_t D>
+class dary_heap {
+    public:
+        using value_type = T;
+
+        dary_heap() = default;
+
+        template<typename It>
+        dary_heap(It first, It last) : data(first, last) {
+            if(data.size() > 1){
+                for(std::size_t i = (data.size() - 2) / D + 1; i-- > 0;){
+                    sift_down(i);
+                }
+            }
+        }
+
+        bool empty() const { return data.empty(); }
+        std::size_t size() const { return data.size(); }
+        const T &top() const { return data.front(); }
+
+        void push(const T &value){
+            data.push_back(value);
+            sift_up(data.size() - 1);
+        }
+
+        void pop(){
+            data.front() = std::move(data.back());
+            data.pop_back();
+            if(!data.empty()){
+                sift_down(0);
+            }
+        }
+
+    private:
+        void sift_up(std::size_t i){
+            T value = std::move(data[i]);
+            while(i > 0){
+                auto parent = (i - 1) / D;
+                if(!(value < data[parent])){
+                    break;
+                }
+                data[i] = std::move(data[parent]);
+                i = parent;
+            }
+            data[i] = std::move(value);
+        }
+
+        void sift_down(std::size_t i){
+            const std::size_t n = data.size();
+            T value = std::move(data[i]);
+
+            while(true){
+                auto first = D * i + 1;
+                if(first >= n){
+                    break;
+                }
+
+                auto last = std::min(first + D, n);
+                auto smallest = first;
+                for(auto c = first + 1; c < last; ++c){
+                    if(data[c] < data[smallest]){
+                        smallest = c;
+                    }
+                }
+
+                if(!(data[smallest] < value)){
+                    break;
+                }
+
+                data[i] = std::move(data[smallest]);
+                i = smallest;
+            }
+
+            data[i] = std::move(value);
+        }
+
+        std::vector<T> data;
+};
+
+// Pairing heap: a multiway tree where push and decrease-key only link two
+// trees and pop merges the children of the root in two passes. Each node is
+// allocated separately, push returns a handle for decrease_key().
+template<typename T>
+class pairing_heap {
+    struct node {
+        T value;
+        node *child = nullptr;
+        node *sibling = nullptr;
+        node *previous = nullptr;   // previous sibling, or parent for the first child
+
+        explicit node(const T &value) : value(value) {}
+    };
+
+    public:
+        using value_type = T;
+        using handle = node *;
+
+        pairing_heap() = default;
+
+        template<typename It>
+        pairing_heap(It first, It last){
+            for(; first != last; ++first){
+                push(*first);
+            }
+        }
+
+        pairing_heap(pairing_heap &&other) noexcept : root(other.root), count(other.count) {
+            other.root = nullptr;
+            other.count = 0;
+        }
+
+        pairing_heap &operator=(pairing_heap &&other) noexcept {
+            std::swap(root, other.root);
+            std::swap(count, other.count);
+            return *this;
+        }
+
+        ~pairing_heap(){
+            // iterative, the trees may be deep
+            std::vector<node *> pending;
+            if(root){
+                pending.push_back(root);
+            }
+
+            while(!pending.empty()){
+                auto n = pending.back();
+                pending.pop_back();
+
+                if(n->child){
+                    pending.push_back(n->child);
+                }
+                if(n->sibling){
+                    pending.push_back(n->sibling);
+                }
+
+                delete n;
+            }
+        }
+
+        bool empty() const { return !root; }
+        std::size_t size() const { return count; }
+        const T &top() const { return root->value; }
+
+        static const T &value(handle h){
+            return h->value;
+        }
+
+        handle push(const T &value){
+            auto n = new node(value);
+            root = root ? link(root, n) : n;
+            ++count;
+            return n;
+        }
+
+        void pop(){
+            auto old = root;
+            root = merge_pairs(root->child);
+            if(root){
+                root->previous = nullptr;
+            }
+            delete old;
+            --count;
+        }
+
+        // The new value must not be greater than the current one
+        void decrease_key(handle h, const T &value){
+            h->value = value;
+            if(h == root){
+                return;
+            }
+
+            // detach the subtree of h and link it with the root
+            if(h->previous->child == h){
+                h->previous->child = h->sibling;
+            } else {
+                h->previous->sibling = h->sibling;
+            }
+
+            if(h->sibling){
+                h->sibling->previous = h->previous;
+            }
+
+            h->sibling = nullptr;
+            h->previous = nullptr;
+            root = link(root, h);
+        }
+
+    private:
+        // the root with the greater value becomes the first child of the other
+        static node *link(node *a, node *b){
+            if(b->value < a->value){
+                std::swap(a, b);
+            }
+
+            b->previous = a;
+            b->sibling = a->child;
+            if(a->child){
+                a->child->previous = b;
+            }
+            a->child = b;
+            a->sibling = nullptr;
+            return a;
+        }
+
+        // link the siblings by pairs from left to right, then the pairs from
+        // right to left
+        node *merge_pairs(node *first){
+            pairs.clear();
+
+            while(first){
+                auto a = first;
+                auto b = first->sibling;
+                if(!b){
+                    a->sibling = nullptr;
+                    pairs.push_back(a);
+                    break;
+                }
+
+                first = b->sibling;
+                a->sibling = nullptr;
+                b->sibling = nullptr;
+                pairs.push_back(link(a, b));
+            }
+
+            node *result = nullptr;
+            for(auto it = pairs.rbegin(); it != pairs.rend(); ++it){
+                result = result ? link(*it, result) : *it;
+            }
+
+            return result;
+        }
+
+        node *root = nullptr;
+        std::size_t count = 0;
+        std::vector<node *> pairs;  // scratch space of merge_pairs
+};
+
+// Radix heap for monotone integer keys (.a): the popped keys never decrease
+// and no key lower than the last popped one can be pushed, as in event
+// simulations. Elements are bucketed by the highest bit in which their key
+// differs from the last popped one, only the first non empty bucket is
+// redistributed when the lowest one is empty.
+template<typename T>
+class radix_heap {
+    public:
+        using value_type = T;
+
+        radix_heap() = default;
+
+        template<typename It>
+        radix_heap(It first, It last){
+            for(; first != last; ++first){
+                push(*first);
+            }
+        }
+
+        bool empty() const { return !count; }
+        std::size_t size() const { return count; }
+
+        const T &top(){
+            refill();
+            return buckets[0].back();
+        }
+
+        void push(const T &value){
+            buckets[bucket(value.a)].push_back(value);
+            ++count;
+        }
+
+        void pop(){
+            refill();
+            buckets[0].pop_back();
+            --count;
+        }
+
+    private:
+        std::size_t bucket(std::uint64_t key) const {
+            return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+        }
+
+        void refill(){
+            if(!buckets[0].empty()){
+                return;
+            }
+
+            std::size_t i = 1;
+            while(buckets[i].empty()){
+                ++i;
+            }
+
+            auto &source = buckets[i];
+            last = std::min_element(source.begin(), source.end(), [](const T &a, const T &b){ return a.a < b.a; })->a;
+
+            // all of them go to lower buckets since they share more bits
+            // with the new minimum
+            for(auto &value : source){
+                buckets[bucket(value.a)].push_back(std::move(value));
+            }
+            source.clear();
+        }
+
+        std::array<std::vector<T>, 65> buckets;
+        std::uint64_t last = 0;
+        std::size_t count = 0;
+};
+
+template<typename Heap>
+struct has_decrease_key : std::false_type {};
+
+template<typename T>
+struct has_decrease_key<pairing_heap<T>> : std::true_type {};
+
+} //end of namespace heaps
+
+#endif
@@ -0,0 +1,146 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_HISTOGRAM
+#define ARTICLES_HISTOGRAM
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Per operation latencies: a cheap timestamp is taken around each operation
+// and the difference is recorded in a log-bucketed histogram
+
+namespace latency {
+
+// Time stamp counter when available, steady clock nanoseconds otherwise
+inline std::uint64_t ticks(){
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Ticks per nanosecond, calibrated once against the steady clock
+inline double ticks_per_ns(){
+    static const double ratio = []{
+#if defined(__x86_64__) || defined(__i386__)
+        auto c0 = std::chrono::steady_clock::now();
+        auto t0 = ticks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        auto t1 = ticks();
+        auto c1 = std::chrono::steady_clock::now();
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(c1 - c0).count();
+        return ns ? static_cast<double>(t1 - t0) / ns : 1.0;
+#else
+        return 1.0;
+#endif
+    }();
+
+    return ratio;
+}
+
+// HDR-style histogram: values are bucketed by their power of two, each one
+// being split in 32 linear sub-buckets, so the relative error is under 3%
+// whatever the magnitude, with a fixed amount of memory
+class histogram {
+    public:
+        static constexpr std::size_t sub_bits = 5;
+        static constexpr std::size_t sub_buckets = std::size_t(1) << sub_bits;
+        static constexpr std::size_t buckets = (64 - sub_bits + 1) * sub_buckets;
+
+        void record(std::uint64_t value){
+            ++counts[index(value)];
+            ++total;
+            largest = std::max(largest, value);
+        }
+
+        void reset(){
+            counts.fill(0);
+            total = 0;
+            largest = 0;
+        }
+
+        std::uint64_t count() const {
+            return total;
+        }
+
+        std::uint64_t max() const {
+            return largest;
+        }
+
+        // Upper bound of the bucket of the given percentile, in per mille
+        std::uint64_t percentile(std::size_t per_mille) const {
+            if(!total){
+                return 0;
+            }
+
+            if(per_mille >= 1000){
+                return largest;
+            }
+
+            std::uint64_t rank = std::max<std::uint64_t>(1, (total * per_mille + 999) / 1000);
+            std::uint64_t seen = 0;
+            for(std::size_t i = 0; i < buckets; ++i){
+                seen += counts[i];
+                if(seen >= rank){
+                    return std::min(upper(i), largest);
+                }
+            }
+
+            return largest;
+        }
+
+    private:
+        static std::size_t index(std::uint64_t value){
+            if(value < sub_buckets){
+                return value;
+            }
+
+            std::size_t exponent = 63 - __builtin_clzll(value);
+            std::size_t mantissa = value >> (exponent - sub_bits);
+            return (exponent - sub_bits + 1) * sub_buckets + (mantissa - sub_buckets);
+        }
+
+        static std::uint64_t upper(std::size_t i){
+            if(i < sub_buckets){
+                return i;
+            }
+
+            std::size_t exponent = i / sub_buckets + sub_bits - 1;
+            std::uint64_t mantissa = i % sub_buckets + sub_buckets;
+            return ((mantissa + 1) << (exponent - sub_bits)) - 1;
+        }
+
+        std::array<std::uint64_t, buckets> counts{};
+        std::uint64_t total = 0;
+        std::uint64_t largest = 0;
+};
+
+// Histogram filled by the timed policies
+inline histogram &current(){
+    static histogram h;
+    return h;
+}
+
+inline std::uint64_t to_ns(std::uint64_t t){
+    return static_cast<std::uint64_t>(t / ticks_per_ns());
+}
+
+} //end of namespace latency
+
+#endif
@@ -0,0 +1,215 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_INDIRECT_VECTOR
+#define ARTICLES_INDIRECT_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "segmented_vector.hpp"
+
+// Sequences storing their elements through an indirection, so that shifting
+// or sorting them only moves pointers or indices, whatever the size of the
+// elements. Their iterators dereference to the elements themselves.
+
+namespace indirect {
+
+// Random access iterator over a sequence of handles, resolved to elements
+template<typename Base, typename Resolve>
+class indirect_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using reference = decltype(std::declval<const Resolve &>()(*std::declval<Base>()));
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+        using pointer = std::remove_reference_t<reference> *;
+        using difference_type = std::ptrdiff_t;
+
+        indirect_iterator() = default;
+        indirect_iterator(Base it, Resolve resolve) : it(it), resolve(resolve) {}
+
+        Base base() const { return it; }
+
+        reference operator*() const { return resolve(*it); }
+        pointer operator->() const { return &resolve(*it); }
+        reference operator[](difference_type n) const { return resolve(it[n]); }
+
+        indirect_iterator &operator++(){ ++it; return *this; }
+        indirect_iterator &operator--(){ --it; return *this; }
+        indirect_iterator operator++(int){ auto copy = *this; ++it; return copy; }
+        indirect_iterator operator--(int){ auto copy = *this; --it; return copy; }
+
+        indirect_iterator &operator+=(difference_type n){ it += n; return *this; }
+        indirect_iterator &operator-=(difference_type n){ it -= n; return *this; }
+        indirect_iterator operator+(difference_type n) const { return {it + n, resolve}; }
+        indirect_iterator operator-(difference_type n) const { return {it - n, resolve}; }
+        friend indirect_iterator operator+(difference_type n, const indirect_iterator &i){ return i + n; }
+        difference_type operator-(const indirect_iterator &other) const { return it - other.it; }
+
+        bool operator==(const indirect_iterator &other) const { return it == other.it; }
+        bool operator!=(const indirect_iterator &other) const { return it != other.it; }
+        bool operator<(const indirect_iterator &other) const { return it < other.it; }
+        bool operator>(const indirect_iterator &other) const { return it > other.it; }
+        bool operator<=(const indirect_iterator &other) const { return it <= other.it; }
+        bool operator>=(const indirect_iterator &other) const { return it >= other.it; }
+
+    private:
+        Base it{};
+        Resolve resolve{};
+};
+
+// Each element allocated on its own, as a vector<unique_ptr<T>>
+template<typename T>
+class pointer_vector {
+    using pointers = std::vector<std::unique_ptr<T>>;
+
+    struct dereference {
+        T &operator()(const std::unique_ptr<T> &p) const { return *p; }
+    };
+
+    public:
+        using value_type = T;
+        using iterator = indirect_iterator<typename pointers::const_iterator, dereference>;
+        using const_iterator = iterator;
+
+        std::size_t size() const { return elements.size(); }
+        bool empty() const { return elements.empty(); }
+
+        iterator begin() const { return {elements.begin(), {}}; }
+        iterator end() const { return {elements.end(), {}}; }
+
+        friend iterator begin(const pointer_vector &v){ return v.begin(); }
+        friend iterator end(const pointer_vector &v){ return v.end(); }
+
+        T &front() const { return *elements.front(); }
+        T &back() const { return *elements.back(); }
+
+        void reserve(std::size_t n){
+            elements.reserve(n);
+        }
+
+        void push_back(const T &value){
+            elements.push_back(std::make_unique<T>(value));
+        }
+
+        void pop_back(){
+            elements.pop_back();
+        }
+
+        iterator insert(const_iterator position, const T &value){
+            return {elements.insert(position.base(), std::make_unique<T>(value)), {}};
+        }
+
+        iterator erase(const_iterator position){
+            return {elements.erase(position.base()), {}};
+        }
+
+        void clear(){
+            elements.clear();
+        }
+
+        // only the pointers move
+        void sort(){
+            std::sort(elements.begin(), elements.end(), [](const auto &a, const auto &b){ return *a < *b; });
+        }
+
+    private:
+        pointers elements;
+};
+
+// The elements in a pool where they never move, the sequence is a vector of
+// 32 bits indices in it, the slots of the erased elements are reused. The
+// pool is a segmented vector, so it grows without moving the elements.
+template<typename T>
+class pool_vector {
+    using indices = std::vector<std::uint32_t>;
+    using storage = segmented::segmented_vector<T>;
+
+    struct in_pool {
+        storage *pool;
+        T &operator()(std::uint32_t i) const { return (*pool)[i]; }
+    };
+
+    public:
+        using value_type = T;
+        using iterator = indirect_iterator<typename indices::const_iterator, in_pool>;
+        using const_iterator = iterator;
+
+        std::size_t size() const { return sequence.size(); }
+        bool empty() const { return sequence.empty(); }
+
+        iterator begin() const { return {sequence.begin(), {pool.get()}}; }
+        iterator end() const { return {sequence.end(), {pool.get()}}; }
+
+        friend iterator begin(const pool_vector &v){ return v.begin(); }
+        friend iterator end(const pool_vector &v){ return v.end(); }
+
+        T &front() const { return (*pool)[sequence.front()]; }
+        T &back() const { return (*pool)[sequence.back()]; }
+
+        void reserve(std::size_t n){
+            sequence.reserve(n);
+        }
+
+        void push_back(const T &value){
+            sequence.push_back(allocate(value));
+        }
+
+        void pop_back(){
+            free.push_back(sequence.back());
+            sequence.pop_back();
+        }
+
+        iterator insert(const_iterator position, const T &value){
+            auto slot = allocate(value);
+            return {sequence.insert(position.base(), slot), {pool.get()}};
+        }
+
+        iterator erase(const_iterator position){
+            free.push_back(*position.base());
+            return {sequence.erase(position.base()), {pool.get()}};
+        }
+
+        void clear(){
+            pool->clear();
+            sequence.clear();
+            free.clear();
+        }
+
+        // only the indices move
+        void sort(){
+            auto &elements = *pool;
+            std::sort(sequence.begin(), sequence.end(), [&](std::uint32_t a, std::uint32_t b){ return elements[a] < elements[b]; });
+        }
+
+    private:
+        std::uint32_t allocate(const T &value){
+            if(free.empty()){
+                pool->push_back(value);
+                return pool->size() - 1;
+            }
+
+            auto slot = free.back();
+            free.pop_back();
+            (*pool)[slot] = value;
+            return slot;
+        }
+
+        // allocated apart, so that the iterators survive a move of the vector
+        std::unique_ptr<storage> pool = std::make_unique<storage>();
+        indices sequence;
+        indices free;
+};
+
+} //end of namespace indirect
+
+#endif
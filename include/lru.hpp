@@ -0,0 +1,310 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_LRU
+#define ARTICLES_LRU
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "concurrent_map.hpp"
+
+// Fixed capacity caches of values by key. get() returns the cached value or
+// nullptr and updates the recency of the key, put() adds a key which is not
+// in the cache, evicting another one when it is full.
+
+namespace lru {
+
+// The classic design: the entries in a std::list from the most to the least
+// recently used one, and an std::unordered_map from the keys to the list
+// nodes
+template<typename T>
+class list_cache {
+    public:
+        using value_type = T;
+
+        explicit list_cache(std::size_t capacity) : capacity(capacity) {
+            index.reserve(capacity);
+        }
+
+        const T *get(std::size_t key){
+            auto it = index.find(key);
+            if(it == index.end()){
+                return nullptr;
+            }
+
+            entries.splice(entries.begin(), entries, it->second);
+            return &it->second->second;
+        }
+
+        void put(std::size_t key, const T &value){
+            if(index.size() == capacity){
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+
+            entries.emplace_front(key, value);
+            index.emplace(key, entries.begin());
+        }
+
+    private:
+        std::size_t capacity;
+        std::list<std::pair<std::size_t, T>> entries;
+        std::unordered_map<std::size_t, typename std::list<std::pair<std::size_t, T>>::iterator> index;
+};
+
+// Open addressing from the keys to the positions of the entries in a
+// vector, with linear probing and backward shift deletion, the table is
+// never more than half full
+class slot_index {
+    public:
+        static constexpr std::uint32_t none = ~std::uint32_t(0);
+
+        explicit slot_index(std::size_t capacity){
+            std::size_t size = 16;
+            while(size < 2 * capacity){
+                size *= 2;
+            }
+
+            slots.resize(size);
+            mask = size - 1;
+        }
+
+        std::uint32_t find(std::size_t key) const {
+            for(auto i = maps::mix(key) & mask;; i = (i + 1) & mask){
+                if(slots[i].position == none || slots[i].key == key){
+                    return slots[i].position;
+                }
+            }
+        }
+
+        void insert(std::size_t key, std::uint32_t position){
+            auto i = maps::mix(key) & mask;
+            while(slots[i].position != none){
+                i = (i + 1) & mask;
+            }
+
+            slots[i] = {key, position};
+        }
+
+        void erase(std::size_t key){
+            auto i = maps::mix(key) & mask;
+            while(slots[i].key != key || slots[i].position == none){
+                i = (i + 1) & mask;
+            }
+
+            // move back the following entries which would not be found
+            // anymore through the hole
+            for(auto j = (i + 1) & mask; slots[j].position != none; j = (j + 1) & mask){
+                auto home = maps::mix(slots[j].key) & mask;
+                if(((j - home) & mask) >= ((j - i) & mask)){
+                    slots[i] = slots[j];
+                    i = j;
+                }
+            }
+
+            slots[i].position = none;
+        }
+
+    private:
+        struct slot {
+            std::size_t key = 0;
+            std::uint32_t position = none;
+        };
+
+        std::vector<slot> slots;
+        std::size_t mask;
+};
+
+// Exact LRU with the entries allocated once in a vector and linked by their
+// positions, looked up through open addressing
+template<typename T>
+class intrusive_cache {
+    public:
+        using value_type = T;
+
+        explicit intrusive_cache(std::size_t capacity) : capacity(capacity), index(capacity) {
+            entries.reserve(capacity);
+        }
+
+        const T *get(std::size_t key){
+            auto position = index.find(key);
+            if(position == slot_index::none){
+                return nullptr;
+            }
+
+            if(position != head){
+                unlink(position);
+                link_front(position);
+            }
+
+            return &entries[position].value;
+        }
+
+        void put(std::size_t key, const T &value){
+            std::uint32_t position;
+            if(entries.size() < capacity){
+                position = entries.size();
+                entries.push_back({key, value});
+            } else {
+                // the least recently used entry is reused
+                position = tail;
+                unlink(position);
+                index.erase(entries[position].key);
+                entries[position].key = key;
+                entries[position].value = value;
+            }
+
+            link_front(position);
+            index.insert(key, position);
+        }
+
+    private:
+        struct entry {
+            std::size_t key;
+            T value;
+            std::uint32_t previous = slot_index::none;
+            std::uint32_t next = slot_index::none;
+        };
+
+        void unlink(std::uint32_t position){
+            auto &e = entries[position];
+            (e.previous == slot_index::none ? head : entries[e.previous].next) = e.next;
+            (e.next == slot_index::none ? tail : entries[e.next].previous) = e.previous;
+        }
+
+        void link_front(std::uint32_t position){
+            auto &e = entries[position];
+            e.previous = slot_index::none;
+            e.next = head;
+            (head == slot_index::none ? tail : entries[head].previous) = position;
+            head = position;
+        }
+
+        std::size_t capacity;
+        std::vector<entry> entries;
+        slot_index index;
+        std::uint32_t head = slot_index::none;
+        std::uint32_t tail = slot_index::none;
+};
+
+// CLOCK: an approximation of LRU where a hit only sets a reference bit, the
+// hand sweeps the entries in a circle to evict the first one which has not
+// been referenced since the last pass, clearing the bits on its way
+template<typename T>
+class clock_cache {
+    public:
+        using value_type = T;
+
+        explicit clock_cache(std::size_t capacity) : capacity(capacity), index(capacity) {
+            entries.reserve(capacity);
+            referenced.reserve(capacity);
+        }
+
+        const T *get(std::size_t key){
+            auto position = index.find(key);
+            if(position == slot_index::none){
+                return nullptr;
+            }
+
+            referenced[position] = 1;
+            return &entries[position].second;
+        }
+
+        void put(std::size_t key, const T &value){
+            if(entries.size() < capacity){
+                index.insert(key, entries.size());
+                entries.emplace_back(key, value);
+                referenced.push_back(0);
+                return;
+            }
+
+            while(referenced[hand]){
+                referenced[hand] = 0;
+                hand = hand + 1 == entries.size() ? 0 : hand + 1;
+            }
+
+            index.erase(entries[hand].first);
+            index.insert(key, hand);
+            entries[hand] = {key, value};
+            hand = hand + 1 == entries.size() ? 0 : hand + 1;
+        }
+
+    private:
+        std::size_t capacity;
+        std::vector<std::pair<std::size_t, T>> entries;
+        std::vector<std::uint8_t> referenced;
+        slot_index index;
+        std::size_t hand = 0;
+};
+
+// Segmented LRU: new keys enter a probationary segment and are promoted to a
+// protected one, 80% of the capacity, on their second hit; the entries
+// demoted from the protected segment get another chance in the probationary
+// one, so that a scan of keys used once does not flush the cache
+template<typename T>
+class segmented_cache {
+    using entries_t = std::list<std::pair<std::size_t, T>>;
+
+    public:
+        using value_type = T;
+
+        explicit segmented_cache(std::size_t capacity) : capacity(capacity), protected_capacity(capacity * 4 / 5) {
+            index.reserve(capacity);
+        }
+
+        const T *get(std::size_t key){
+            auto it = index.find(key);
+            if(it == index.end()){
+                return nullptr;
+            }
+
+            auto &location = it->second;
+            if(location.second){
+                protected_entries.splice(protected_entries.begin(), protected_entries, location.first);
+            } else if(!protected_capacity){
+                probation.splice(probation.begin(), probation, location.first);
+            } else {
+                if(protected_entries.size() == protected_capacity){
+                    index[protected_entries.back().first].second = false;
+                    probation.splice(probation.begin(), protected_entries, std::prev(protected_entries.end()));
+                }
+
+                protected_entries.splice(protected_entries.begin(), probation, location.first);
+                location.second = true;
+            }
+
+            return &location.first->second;
+        }
+
+        void put(std::size_t key, const T &value){
+            if(index.size() == capacity){
+                auto &victims = probation.empty() ? protected_entries : probation;
+                index.erase(victims.back().first);
+                victims.pop_back();
+            }
+
+            probation.emplace_front(key, value);
+            index.emplace(key, std::make_pair(probation.begin(), false));
+        }
+
+    private:
+        std::size_t capacity;
+        std::size_t protected_capacity;
+        entries_t probation;
+        entries_t protected_entries;
+        std::unordered_map<std::size_t, std::pair<typename entries_t::iterator, bool>> index;
+};
+
+} //end of namespace lru
+
+#endif
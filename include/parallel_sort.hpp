@@ -0,0 +1,116 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_PARALLEL_SORT
+#define ARTICLES_PARALLEL_SORT
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "thread_pool.hpp"
+
+namespace parallel {
+
+namespace detail {
+
+// Merge two sorted ranges splitting the larger one in the middle and the other
+// one at the same value, so that both halves can be merged independently
+template<typename In, typename Out>
+void merge(In first1, In last1, In first2, In last2, Out out, std::size_t grain){
+    auto n1 = last1 - first1;
+    auto n2 = last2 - first2;
+
+    if(static_cast<std::size_t>(n1 + n2) <= grain){
+        std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                   std::make_move_iterator(first2), std::make_move_iterator(last2), out);
+        return;
+    }
+
+    if(n1 < n2){
+        std::swap(first1, first2);
+        std::swap(last1, last2);
+        std::swap(n1, n2);
+    }
+
+    auto mid1 = first1 + n1 / 2;
+    auto mid2 = std::lower_bound(first2, last2, *mid1);
+    auto mid_out = out + ((mid1 - first1) + (mid2 - first2));
+    *mid_out = std::move(*mid1);
+
+    task_group group;
+    group.run([=]{ merge(first1, mid1, first2, mid2, out, grain); });
+    merge(mid1 + 1, last1, mid2, last2, mid_out + 1, grain);
+    group.wait();
+}
+
+// Sort [first, last) using other as scratch space of the same size, the
+// result ends up in other when to_other is set. Each level of the recursion
+// alternates the two buffers, so no data is copied back.
+template<typename It, typename Other>
+void merge_sort(It first, It last, Other other, bool to_other, std::size_t grain){
+    std::size_t n = last - first;
+
+    if(n <= grain){
+        std::sort(first, last);
+        if(to_other){
+            std::move(first, last, other);
+        }
+        return;
+    }
+
+    std::size_t half = n / 2;
+
+    task_group group;
+    group.run([=]{ merge_sort(first, first + half, other, !to_other, grain); });
+    merge_sort(first + half, last, other + half, !to_other, grain);
+    group.wait();
+
+    if(to_other){
+        merge(first, first + half, first + half, last, other, grain);
+    } else {
+        merge(other, other + half, other + half, other + n, first, grain);
+    }
+}
+
+} //end of namespace detail
+
+// Fork-join merge sort on the work-stealing pool, merges are parallel too
+template<typename RandomIt>
+void merge_sort(RandomIt first, RandomIt last){
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+
+    const std::size_t n = std::distance(first, last);
+    const std::size_t threads = thread_pool::instance().size();
+    const std::size_t chunks = threads * 4;
+    const std::size_t grain = std::max<std::size_t>(n / (threads * 8), 2048);
+
+    if(n <= grain){
+        std::sort(first, last);
+        return;
+    }
+
+    std::allocator<T> allocator;
+    T *buffer = allocator.allocate(n);
+
+    parallel_for(n, chunks, [&](std::size_t begin, std::size_t end){
+        std::uninitialized_move(first + begin, first + end, buffer + begin);
+    });
+
+    detail::merge_sort(buffer, buffer + n, first, true, grain);
+
+    parallel_for(n, chunks, [&](std::size_t begin, std::size_t end){
+        std::destroy(buffer + begin, buffer + end);
+    });
+
+    allocator.deallocate(buffer, n);
+}
+
+} //end of namespace parallel
+
+#endif
@@ -5,8 +5,29 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <optional>
 #include <type_traits>
 
+#ifdef BENCH_HAVE_TBB
+#include <execution>
+#endif
+
+#include "chase_lev.hpp"
+#include "concurrency.hpp"
+#include "concurrent_map.hpp"
+#include "distributions.hpp"
+#include "heaps.hpp"
+#include "histogram.hpp"
+#include "indirect_vector.hpp"
+#include "lru.hpp"
+#include "parallel_sort.hpp"
+#include "radix_sort.hpp"
+#include "search.hpp"
+#include "trace.hpp"
+
 // create policies
 
 //Create empty container
@@ -24,11 +45,22 @@ constexpr bool is_list() {
     return std::is_same_v<Container, std::list<typename Container::value_type>>;
 }
 
+template<class Container>
+constexpr bool is_vector() {
+    return std::is_same_v<Container, std::vector<typename Container::value_type>>;
+}
+
 template<class Container>
 constexpr bool is_forward_list() {
     return std::is_same_v<Container, std::forward_list<typename Container::value_type>>;
 }
 
+template<class Container>
+constexpr bool is_random_access() {
+    return std::is_base_of_v<std::random_access_iterator_tag,
+        typename std::iterator_traits<typename Container::iterator>::iterator_category>;
+}
+
 template<class Container>
 constexpr bool has_random_insert() {
     return !is_forward_list<Container>();
@@ -97,6 +129,36 @@ struct EmptyPrepareBackup {
 template<class Container>
 std::vector<typename Container::value_type> EmptyPrepareBackup<Container>::v;
 
+//Prepare the random keys inserted by RandomSortedInsert, drawn from the
+//distribution if any, new ones for each make otherwise
+template<class Container>
+struct EmptyPrepareRandomKeys {
+    static std::mt19937 generator;
+    static std::vector<std::size_t> keys;
+    inline static Container make(std::size_t size) {
+        std::uniform_int_distribution<std::size_t> distribution(0, std::numeric_limits<std::size_t>::max() - 1);
+        distributions::generator drawn(size);
+
+        keys.clear();
+        keys.reserve(size);
+        for(std::size_t i = 0; i < size; ++i){
+            keys.push_back(distributions::enabled() ? drawn() : distribution(generator));
+        }
+
+        return Container();
+    }
+
+    inline static void clean(){
+        keys.clear();
+        keys.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::mt19937 EmptyPrepareRandomKeys<Container>::generator;
+template<class Container>
+std::vector<std::size_t> EmptyPrepareRandomKeys<Container>::keys;
+
 template<class Container>
 struct Filled {
     inline static Container make(std::size_t size) {
@@ -167,6 +229,336 @@ struct FilledSequential {
 template<class Container>
 std::vector<typename Container::value_type> FilledSequential<Container>::v;
 
+// Number of chunks the parallel policies split a container in
+inline std::size_t parallel_chunks(){
+    auto threads = parallel::thread_pool::instance().size();
+    return threads == 1 ? 1 : threads * 4;
+}
+
+// Same as FilledRandom, also computing where the parallel policies split the
+// container, since lists can't be split without walking them
+template<class Container>
+struct FilledRandomSplit {
+    static std::vector<typename Container::iterator> splits;
+    inline static Container make(std::size_t size){
+        auto container = FilledRandom<Container>::make(size);
+
+        splits.clear();
+        if constexpr (!is_random_access<Container>()) {
+            auto chunks = parallel_chunks();
+            auto it = container.begin();
+            std::size_t position = 0;
+
+            for(std::size_t i = 0; i < chunks; ++i){
+                std::size_t next = size * i / chunks;
+                std::advance(it, next - position);
+                position = next;
+                splits.push_back(it);
+            }
+        }
+
+        return container;
+    }
+
+    inline static void clean(){
+        FilledRandom<Container>::clean();
+        splits.clear();
+        splits.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::iterator> FilledRandomSplit<Container>::splits;
+
+// Random data, the synthetic trace is prepared for this initial size
+template<class Container>
+struct FilledTrace {
+    inline static Container make(std::size_t size){
+        trace::prepare(size);
+        return FilledRandom<Container>::make(size);
+    }
+
+    inline static void clean(){
+        FilledRandom<Container>::clean();
+    }
+};
+
+// Concurrent map with the keys from 0 to size, room is made for twice as many
+template<class Container>
+struct FilledMap {
+    inline static Container make(std::size_t size){
+        using T = typename Container::value_type;
+
+        Container container(2 * size);
+        for(std::size_t i = 0; i < size; ++i){
+            container.insert_or_assign(i, T{i});
+        }
+
+        return container;
+    }
+
+    inline static void clean(){}
+};
+
+// Empty heap, the keys from 0 to size to push are prepared in the same
+// random order as FilledRandom
+template<class Heap>
+struct HeapKeys {
+    static std::vector<typename Heap::value_type> v;
+    inline static Heap make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                v.push_back({i});
+            }
+            std::shuffle(begin(v), end(v), std::mt19937());
+        }
+
+        return Heap();
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+    }
+};
+
+template<class Heap>
+std::vector<typename Heap::value_type> HeapKeys<Heap>::v;
+
+// Handles of the elements of the heaps supporting decrease-key
+template<class Heap>
+struct HeapHandles {
+    static std::vector<typename Heap::handle> v;
+};
+
+template<class Heap>
+std::vector<typename Heap::handle> HeapHandles<Heap>::v;
+
+// Heap filled with the random keys, the handles of the elements are kept
+// when the heap supports decrease-key
+template<class Heap>
+struct FilledHeap {
+    inline static Heap make(std::size_t size){
+        auto heap = HeapKeys<Heap>::make(size);
+
+        if constexpr (heaps::has_decrease_key<Heap>::value) {
+            HeapHandles<Heap>::v.clear();
+            for(auto &value : HeapKeys<Heap>::v){
+                HeapHandles<Heap>::v.push_back(heap.push(value));
+            }
+        } else {
+            for(auto &value : HeapKeys<Heap>::v){
+                heap.push(value);
+            }
+        }
+
+        return heap;
+    }
+
+    inline static void clean(){
+        if constexpr (heaps::has_decrease_key<Heap>::value) {
+            HeapHandles<Heap>::v.clear();
+            HeapHandles<Heap>::v.shrink_to_fit();
+        }
+        HeapKeys<Heap>::clean();
+    }
+};
+
+// Requests over 65536 keys drawn from a distribution, shared by the caches
+template<class Keys>
+struct RequestStream {
+    static constexpr std::size_t requests = 1 << 18;
+    static constexpr std::size_t keys = 1 << 16;
+
+    static std::vector<std::size_t> v;
+    inline static void prepare(){
+        if(v.empty()){
+            static const auto settings = distributions::parse(Keys::distribution);
+            distributions::generator generator(settings, keys);
+
+            v.reserve(requests);
+            for(std::size_t i = 0; i < requests; ++i){
+                v.push_back(generator());
+            }
+        }
+    }
+};
+
+template<class Keys>
+std::vector<std::size_t> RequestStream<Keys>::v;
+
+struct UniformKeys { static constexpr const char *distribution = "uniform"; };
+struct ZipfKeys    { static constexpr const char *distribution = "zipf:0.99"; };
+
+// Empty cache of the given capacity
+template<class Cache, class Keys>
+struct EmptyCache {
+    inline static Cache make(std::size_t capacity){
+        RequestStream<Keys>::prepare();
+        return Cache(capacity);
+    }
+
+    inline static void clean(){}
+};
+
+template<class Cache> using EmptyCacheUniform = EmptyCache<Cache, UniformKeys>;
+template<class Cache> using EmptyCacheZipf    = EmptyCache<Cache, ZipfKeys>;
+
+// Sorted even keys, built into the layout of the searched container, with
+// queries for half present and half missing keys drawn uniformly or with
+// 90% of them going to 10% of the keys
+template<class Container>
+struct FilledSorted {
+    static constexpr std::size_t queries = 1 << 20;
+
+    static std::vector<typename Container::value_type> v;
+    static std::vector<std::size_t> uniform;
+    static std::vector<std::size_t> skewed;
+
+    inline static Container make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                container_push_value(v, 2 * i);
+            }
+
+            std::mt19937 generator;
+            std::uniform_int_distribution<std::size_t> any(0, 2 * size - 1);
+            std::uniform_int_distribution<std::size_t> hot(0, (size - 1) / 10);
+            std::uniform_int_distribution<std::size_t> percent(0, 99);
+
+            uniform.clear();
+            skewed.clear();
+            for(std::size_t i = 0; i < queries; ++i){
+                uniform.push_back(any(generator));
+                skewed.push_back(percent(generator) < 90 ? 20 * hot(generator) : any(generator));
+            }
+        }
+
+        return Container(v);
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+        uniform.clear();
+        uniform.shrink_to_fit();
+        skewed.clear();
+        skewed.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> FilledSorted<Container>::v;
+template<class Container>
+std::vector<std::size_t> FilledSorted<Container>::uniform;
+template<class Container>
+std::vector<std::size_t> FilledSorted<Container>::skewed;
+
+// Random data spread over an array of independent lists, each key in the list
+// of its value modulo the number of lists
+template<class Container>
+struct FilledRandomLists {
+    static std::vector<typename Container::value_type::value_type> v;
+    inline static Container make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                container_push_value(v, i);
+            }
+            std::shuffle(begin(v), end(v), std::mt19937());
+        }
+
+        Container lists;
+        for(std::size_t i = 0; i < size; ++i){
+            container_push_value(lists[v[i].a % lists.size()], v[i]);
+        }
+
+        return lists;
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type::value_type> FilledRandomLists<Container>::v;
+
+// Same data as FilledRandom, in a list whose nodes are scattered in memory as
+// in a long-lived heap: decoys of random size are allocated between the nodes
+// (and kept alive until the next list is made), then the nodes are relinked in
+// a pseudo-random order (sorting a list relinks the nodes without moving them)
+template<class Container>
+struct FilledScattered {
+    static std::vector<typename Container::value_type> v;
+    static std::vector<std::unique_ptr<char[]>> decoys;
+    inline static Container make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                container_push_value(v, i);
+            }
+            std::shuffle(begin(v), end(v), std::mt19937());
+        }
+
+        decoys.clear();
+        decoys.reserve(size);
+
+        std::mt19937 generator;
+        std::uniform_int_distribution<std::size_t> decoy_size(16, 256);
+
+        Container container;
+        for(std::size_t i = 0; i < size; ++i){
+            container_push_value(container, v[i]);
+            decoys.emplace_back(new char[decoy_size(generator)]);
+        }
+
+        container.sort([](decltype(*begin(container)) a, decltype(*begin(container)) b){
+            return maps::mix(a.a) < maps::mix(b.a);
+        });
+
+        return container;
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+        decoys.clear();
+        decoys.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> FilledScattered<Container>::v;
+template<class Container>
+std::vector<std::unique_ptr<char[]>> FilledScattered<Container>::decoys;
+
+// FilledScattered list after a defragmentation pass relinking the nodes in
+// the order of their addresses, so that a traversal walks memory forward
+template<class Container>
+struct FilledCompacted {
+    inline static Container make(std::size_t size){
+        auto container = FilledScattered<Container>::make(size);
+
+        container.sort([](decltype(*begin(container)) a, decltype(*begin(container)) b){
+            return std::less<const void *>()(&a, &b);
+        });
+
+        return container;
+    }
+
+    inline static void clean(){
+        FilledScattered<Container>::clean();
+    }
+};
+
 template<class Container>
 struct FilledRandomInsert {
     static std::vector<typename Container::value_type> v;
@@ -244,59 +636,283 @@ struct BackupSmartFilled {
 template<class Container>
 std::vector<typename Container::value_type> BackupSmartFilled<Container>::v;
 
-// testing policies
-
-template<class Container>
-struct NoOp {
-    inline static void run(Container &, std::size_t) {
-        //Nothing
+// Source filled with random data and a target for the whole container
+// copies, moves and swaps: none to construct it or Percent% as many elements
+// to assign it
+template<class Container, std::size_t Percent>
+struct FilledPair {
+    using pair = std::pair<Container, std::optional<Container>>;
+
+    inline static pair make(std::size_t size){
+        pair p(FilledRandom<Container>::make(size), std::nullopt);
+        if(Percent){
+            p.second.emplace(size * Percent / 100);
+        }
+        return p;
     }
-};
 
-template<class Container>
-struct ReserveSize {
-    inline static void run(Container &c, std::size_t size){
-        c.reserve(size);
+    inline static void clean(){
+        FilledRandom<Container>::clean();
     }
 };
 
+template<class Container> using FilledSource        = FilledPair<Container, 0>;
+template<class Container> using FilledTargetSame    = FilledPair<Container, 100>;
+template<class Container> using FilledTargetSmaller = FilledPair<Container, 50>;
+template<class Container> using FilledTargetLarger  = FilledPair<Container, 200>;
+
+// Filled with random data, along with as many random positions in it
 template<class Container>
-struct InsertSimple {
-    static const typename Container::value_type value;
-    inline static void run(Container &c, std::size_t size){
-        if constexpr (has_random_insert<Container>()) {
-            for(size_t i=0; i<size; ++i){
-                c.insert(value);
+struct FilledRandomIndices {
+    static std::vector<std::size_t> indices;
+    inline static Container make(std::size_t size){
+        if(indices.size() != size){
+            std::mt19937 generator;
+            std::uniform_int_distribution<std::size_t> position(0, size - 1);
+
+            indices.clear();
+            indices.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                indices.push_back(position(generator));
             }
         }
+
+        return FilledRandom<Container>::make(size);
+    }
+
+    inline static void clean(){
+        indices.clear();
+        indices.shrink_to_fit();
+        FilledRandom<Container>::clean();
     }
 };
 
 template<class Container>
-const typename Container::value_type InsertSimple<Container>::value{};
+std::vector<std::size_t> FilledRandomIndices<Container>::indices;
 
+// Filled with random data, along with the keys looked up by Find. With a
+// distribution, the drawn ranks are positions in the container so that the
+// hot keys are the ones at the front, otherwise the keys are in order.
 template<class Container>
-struct FillBack {
-    static const typename Container::value_type value;
-    inline static void run(Container &c, std::size_t size){
-        if constexpr (can_push_back<Container>()) {
-            for(size_t i=0; i<size; ++i){
-                container_push_value(c, value);
+struct FilledRandomLookups {
+    static std::vector<std::size_t> keys;
+    inline static Container make(std::size_t size){
+        auto container = FilledRandom<Container>::make(size);
+
+        if(keys.size() != size){
+            auto &v = FilledRandom<Container>::v;
+            distributions::generator ranks(size);
+
+            keys.clear();
+            keys.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                if(!distributions::enabled()){
+                    keys.push_back(i);
+                } else {
+                    // the values are pushed at the front when there is no random insert
+                    auto rank = ranks();
+                    keys.push_back(has_random_insert<Container>() ? v[rank].a : v[size - 1 - rank].a);
+                }
             }
         }
+
+        return container;
+    }
+
+    inline static void clean(){
+        keys.clear();
+        keys.shrink_to_fit();
+        FilledRandom<Container>::clean();
     }
 };
 
-template <class Container>
-const typename Container::value_type FillBack<Container>::value{};
+template<class Container>
+std::vector<std::size_t> FilledRandomLookups<Container>::keys;
 
+// Filled with random data, along with the 1000 keys erased by Erase, drawn
+// from the distribution if any, the first ones otherwise
 template<class Container>
-struct FillBackBackup {
-    inline static void run(Container &c, std::size_t size){
-        if constexpr (can_push_back<Container>()) {
-            for(size_t i=0; i<size; ++i){
-                container_push_value(c, EmptyPrepareBackup<Container>::v[i]);
-            }
+struct FilledRandomErasures {
+    static constexpr std::size_t erasures = 1000;
+
+    static std::vector<std::size_t> keys;
+    inline static Container make(std::size_t size){
+        distributions::generator generator(size);
+
+        keys.clear();
+        for(std::size_t i = 0; i < erasures; ++i){
+            keys.push_back(distributions::enabled() ? generator() : i);
+        }
+
+        return FilledRandom<Container>::make(size);
+    }
+
+    inline static void clean(){
+        keys.clear();
+        keys.shrink_to_fit();
+        FilledRandom<Container>::clean();
+    }
+};
+
+template<class Container>
+std::vector<std::size_t> FilledRandomErasures<Container>::keys;
+
+// Filled with random data, along with the keys erased by RandomErase*. With
+// a distribution, as many draws as the expected number of erased elements,
+// but a key may be drawn more than once.
+template<class Container, std::size_t PerTenThousand>
+struct FilledRandomDrawn {
+    static std::mt19937 generator;
+    static std::vector<bool> drawn;
+    inline static Container make(std::size_t size){
+        drawn.assign(size, false);
+
+        if(distributions::enabled()){
+            distributions::generator keys(size);
+            for(std::size_t i = 0; i < size * PerTenThousand / 10000; ++i){
+                drawn[keys()] = true;
+            }
+        } else {
+            std::uniform_int_distribution<std::size_t> distribution(0, 10000);
+            for(std::size_t i = 0; i < size; ++i){
+                drawn[i] = distribution(generator) > 10000 - PerTenThousand;
+            }
+        }
+
+        return FilledRandom<Container>::make(size);
+    }
+
+    inline static void clean(){
+        drawn.clear();
+        drawn.shrink_to_fit();
+        FilledRandom<Container>::clean();
+    }
+};
+
+template<class Container, std::size_t PerTenThousand>
+std::mt19937 FilledRandomDrawn<Container, PerTenThousand>::generator;
+template<class Container, std::size_t PerTenThousand>
+std::vector<bool> FilledRandomDrawn<Container, PerTenThousand>::drawn;
+
+template<class Container> using FilledRandomDrawn1  = FilledRandomDrawn<Container, 100>;
+template<class Container> using FilledRandomDrawn10 = FilledRandomDrawn<Container, 1000>;
+template<class Container> using FilledRandomDrawn25 = FilledRandomDrawn<Container, 2500>;
+template<class Container> using FilledRandomDrawn50 = FilledRandomDrawn<Container, 5000>;
+
+// Sorted keys, each of them four times in a row
+template<class Container>
+struct FilledRuns {
+    static std::vector<typename Container::value_type> v;
+    inline static Container make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                container_push_value(v, i / 4);
+            }
+        }
+
+        return Container(v.begin(), v.end());
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> FilledRuns<Container>::v;
+
+// Two sorted containers of half the size, holding the multiples of two and
+// the multiples of three
+template<class Container>
+struct FilledSortedPair {
+    using pair = std::pair<Container, Container>;
+
+    static std::vector<typename Container::value_type> first;
+    static std::vector<typename Container::value_type> second;
+
+    inline static pair make(std::size_t size){
+        if(first.size() != size / 2){
+            first.clear();
+            second.clear();
+            for(std::size_t i = 0; i < size / 2; ++i){
+                container_push_value(first, 2 * i);
+                container_push_value(second, 3 * i);
+            }
+        }
+
+        return pair(Container(first.begin(), first.end()), Container(second.begin(), second.end()));
+    }
+
+    inline static void clean(){
+        first.clear();
+        first.shrink_to_fit();
+        second.clear();
+        second.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> FilledSortedPair<Container>::first;
+
+template<class Container>
+std::vector<typename Container::value_type> FilledSortedPair<Container>::second;
+
+// testing policies
+
+template<class Container>
+struct NoOp {
+    inline static void run(Container &, std::size_t) {
+        //Nothing
+    }
+};
+
+template<class Container>
+struct ReserveSize {
+    inline static void run(Container &c, std::size_t size){
+        c.reserve(size);
+    }
+};
+
+template<class Container>
+struct InsertSimple {
+    static const typename Container::value_type value;
+    inline static void run(Container &c, std::size_t size){
+        if constexpr (has_random_insert<Container>()) {
+            for(size_t i=0; i<size; ++i){
+                c.insert(value);
+            }
+        }
+    }
+};
+
+template<class Container>
+const typename Container::value_type InsertSimple<Container>::value{};
+
+template<class Container>
+struct FillBack {
+    static const typename Container::value_type value;
+    inline static void run(Container &c, std::size_t size){
+        if constexpr (can_push_back<Container>()) {
+            for(size_t i=0; i<size; ++i){
+                container_push_value(c, value);
+            }
+        }
+    }
+};
+
+template <class Container>
+const typename Container::value_type FillBack<Container>::value{};
+
+template<class Container>
+struct FillBackBackup {
+    inline static void run(Container &c, std::size_t size){
+        if constexpr (can_push_back<Container>()) {
+            for(size_t i=0; i<size; ++i){
+                container_push_value(c, EmptyPrepareBackup<Container>::v[i]);
+            }
         }
     }
 };
@@ -344,6 +960,101 @@ struct EmplaceBack {
     }
 };
 
+//Prepare a list holding the data of fill back, to be spliced
+template<class Container>
+struct EmptyPrepareList {
+    static Container prepared;
+    inline static Container make(std::size_t size) {
+        EmptyPrepareBackup<Container>::make(size);
+
+        auto &v = EmptyPrepareBackup<Container>::v;
+        prepared.assign(v.begin(), v.end());
+
+        return Container();
+    }
+
+    inline static void clean(){
+        prepared.clear();
+        EmptyPrepareBackup<Container>::clean();
+    }
+};
+
+template<class Container>
+Container EmptyPrepareList<Container>::prepared;
+
+// The bulk operations fill the container with the whole data of fill back at
+// once, instead of one element at a time
+
+template<class Container>
+struct InsertRange {
+    inline static void run(Container &c, std::size_t){
+        auto &v = EmptyPrepareBackup<Container>::v;
+        if constexpr (is_forward_list<Container>()) {
+            c.insert_after(c.before_begin(), v.begin(), v.end());
+        } else {
+            c.insert(c.end(), v.begin(), v.end());
+        }
+    }
+};
+
+template<class Container>
+struct AssignRange {
+    inline static void run(Container &c, std::size_t){
+        auto &v = EmptyPrepareBackup<Container>::v;
+        c.assign(v.begin(), v.end());
+    }
+};
+
+template<class Container>
+struct RangeConstruct {
+    inline static void run(Container &c, std::size_t){
+        auto &v = EmptyPrepareBackup<Container>::v;
+        c = Container(v.begin(), v.end());
+    }
+};
+
+template<class Container>
+struct ResizeCopy {
+    inline static void run(Container &c, std::size_t size){
+        auto &v = EmptyPrepareBackup<Container>::v;
+        c.resize(size);
+        std::copy(v.begin(), v.end(), c.begin());
+    }
+};
+
+// Only for contiguous containers of trivially copyable types
+template<class Container>
+struct ResizeMemcpy {
+    static_assert(std::is_trivially_copyable<typename Container::value_type>::value, "memcpy() needs trivially copyable types");
+
+    inline static void run(Container &c, std::size_t size){
+        auto &v = EmptyPrepareBackup<Container>::v;
+        c.resize(size);
+        std::memcpy(static_cast<void *>(c.data()), static_cast<const void *>(v.data()), size * sizeof(typename Container::value_type));
+    }
+};
+
+template<class Container>
+struct BackInserterCopy {
+    inline static void run(Container &c, std::size_t){
+        auto &v = EmptyPrepareBackup<Container>::v;
+        std::copy(v.begin(), v.end(), std::back_inserter(c));
+    }
+};
+
+// Only the nodes of the prepared list are relinked
+template<class Container>
+struct SpliceList {
+    inline static void run(Container &c, std::size_t){
+        auto &prepared = EmptyPrepareList<Container>::prepared;
+        if constexpr (is_forward_list<Container>()) {
+            c.splice_after(c.before_begin(), prepared);
+        } else {
+            c.splice(c.end(), prepared);
+        }
+    }
+};
+
 template<class Container>
 struct EmplaceInsertSimple {
     inline static void run(Container &c, std::size_t size){
@@ -393,13 +1104,14 @@ struct EmplaceFront<std::vector<T> > {
     }
 };
 
+// Look up the keys prepared by FilledRandomLookups
 template<class Container>
 struct Find {
     static size_t X;
-    inline static void run(Container &c, std::size_t size){
-        for(std::size_t i=0; i<size; ++i) {
+    inline static void run(Container &c, std::size_t){
+        for(auto key : FilledRandomLookups<Container>::keys) {
             // hand written comparison to eliminate temporary object creation
-            if(std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a == i; }) == std::end(c)){
+            if(std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a == key; }) == std::end(c)){
                 ++X;
             }
         }
@@ -409,6 +1121,37 @@ struct Find {
 template<class Container>
 size_t Find<Container>::X = 0;
 
+// Look up the queries prepared by FilledSorted
+template<class Container>
+struct SearchSorted {
+    static size_t X;
+    inline static void run(Container &c, const std::vector<std::size_t> &queries){
+        for(auto key : queries){
+            auto found = search::lower_bound(c, key);
+            if(found && found->a == key){
+                ++X;
+            }
+        }
+    }
+};
+
+template<class Container>
+size_t SearchSorted<Container>::X = 0;
+
+template<class Container>
+struct SearchUniform : SearchSorted<Container> {
+    inline static void run(Container &c, std::size_t){
+        SearchSorted<Container>::run(c, FilledSorted<Container>::uniform);
+    }
+};
+
+template<class Container>
+struct SearchSkewed : SearchSorted<Container> {
+    inline static void run(Container &c, std::size_t){
+        SearchSorted<Container>::run(c, FilledSorted<Container>::skewed);
+    }
+};
+
 template<class Container>
 struct Insert {
     static std::array<typename Container::value_type, 1000> values;
@@ -426,6 +1169,79 @@ struct Insert {
 template<class Container>
 std::array<typename Container::value_type, 1000> Insert<Container>::values {};
 
+// Same insertions as Insert, buffered in batches: a single scan finds where
+// all the values of a batch go, then the batch is sorted by position and
+// merged in with one backward pass that moves each element at most once.
+// Lists splice the nodes of the batch in instead.
+template<class Container, std::size_t Batch>
+struct BatchInsert {
+    using position = std::conditional_t<is_random_access<Container>(), std::size_t, typename Container::iterator>;
+
+    inline static void run(Container &c, std::size_t){
+        if constexpr (has_random_insert<Container>()) {
+            const auto &values = Insert<Container>::values;
+            std::array<std::pair<position, std::size_t>, Batch> batch;
+
+            for(std::size_t first = 0; first < values.size(); first += Batch){
+                const std::size_t count = std::min(Batch, values.size() - first);
+                position end_position;
+
+                if constexpr (is_random_access<Container>())
+                    end_position = c.size();
+                else
+                    end_position = c.end();
+
+                for(std::size_t k = 0; k < count; ++k){
+                    batch[k] = {end_position, first + k};
+                }
+
+                std::size_t found = 0;
+                std::size_t index = 0;
+                for(auto it = c.begin(); it != c.end() && found < count; ++it, ++index){
+                    std::size_t k = it->a - first;
+                    if(k < count && batch[k].first == end_position){
+                        if constexpr (is_random_access<Container>())
+                            batch[k].first = index;
+                        else
+                            batch[k].first = it;
+                        ++found;
+                    }
+                }
+
+                if constexpr (is_random_access<Container>()) {
+                    std::sort(batch.begin(), batch.begin() + count);
+
+                    std::size_t source = c.size();
+                    c.resize(source + count);
+                    std::size_t dest = c.size();
+
+                    auto base = c.begin();
+                    for(std::size_t k = count; k--;){
+                        std::size_t p = batch[k].first;
+                        dest = std::move_backward(base + p, base + source, base + dest) - base;
+                        source = p;
+                        base[--dest] = values[batch[k].second];
+                    }
+                } else {
+                    Container nodes;
+                    for(std::size_t k = 0; k < count; ++k){
+                        nodes.push_back(values[batch[k].second]);
+                    }
+
+                    for(std::size_t k = 0; k < count; ++k){
+                        c.splice(batch[k].first, nodes, nodes.begin());
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<class Container> using BatchInsert1    = BatchInsert<Container, 1>;
+template<class Container> using BatchInsert8    = BatchInsert<Container, 8>;
+template<class Container> using BatchInsert64   = BatchInsert<Container, 64>;
+template<class Container> using BatchInsert1000 = BatchInsert<Container, 1000>;
+
 template<class Container>
 struct Write {
     inline static void run(Container &c, std::size_t){
@@ -452,6 +1268,421 @@ struct Iterate {
     }
 };
 
+// Call function(first, last) on each chunk of the container, in parallel.
+// Random access containers are split by index, the others on the split points
+// computed by FilledRandomSplit
+template<class Container, typename Function>
+inline static void parallel_chunks_for(Container &c, Function &&function){
+    if constexpr (is_random_access<Container>()) {
+        auto first = c.begin();
+        parallel::parallel_for(c.size(), parallel_chunks(), [&](std::size_t begin, std::size_t end){
+            function(first + begin, first + end);
+        });
+    } else {
+        auto &splits = FilledRandomSplit<Container>::splits;
+        if(splits.size() <= 1){
+            function(c.begin(), c.end());
+            return;
+        }
+
+        parallel::task_group group;
+        for(std::size_t i = 1; i < splits.size(); ++i){
+            auto first = splits[i];
+            auto last = i + 1 < splits.size() ? splits[i + 1] : c.end();
+            group.run([&function, first, last]{ function(first, last); });
+        }
+
+        function(splits[0], splits[1]);
+        group.wait();
+    }
+}
+
+// The keys are accumulated so that the traversal can't be optimized out
+template<class Container>
+struct ParallelIterate {
+    static std::atomic<std::size_t> X;
+    inline static void run(Container &c, std::size_t){
+        parallel_chunks_for(c, [](auto it, auto end){
+            std::size_t sum = 0;
+            while(it != end){
+                sum += it->a;
+                ++it;
+            }
+            X.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+};
+
+template<class Container>
+std::atomic<std::size_t> ParallelIterate<Container>::X{0};
+
+template<class Container>
+struct ParallelWrite {
+    inline static void run(Container &c, std::size_t){
+        parallel_chunks_for(c, [](auto it, auto end){
+            for(; it != end; ++it){
+                ++(it->a);
+            }
+        });
+    }
+};
+
+template<class Container>
+struct ParallelFind {
+    static size_t X;
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i) {
+            std::atomic<bool> found{false};
+            parallel_chunks_for(c, [&](auto first, auto last){
+                // hand written comparison to eliminate temporary object creation
+                if(std::find_if(first, last, [&](decltype(*first) v){ return v.a == i; }) != last){
+                    found.store(true, std::memory_order_relaxed);
+                }
+            });
+
+            if(!found.load(std::memory_order_relaxed)){
+                ++X;
+            }
+        }
+    }
+};
+
+template<class Container>
+size_t ParallelFind<Container>::X = 0;
+
+// The owner pushes the indices of all the elements but only pops back the
+// Stolen% it leaves to the other threads, which keep stealing until it is
+// done. The leftovers are drained by the owner, the keys of the elements of
+// the tasks are summed.
+template<class Container, template<class> class Deque, std::size_t Stolen>
+struct OwnerAndThieves {
+    static std::atomic<std::size_t> X;
+    inline static void run(Container &c, std::size_t size){
+        Deque<std::uint64_t> deque;
+        std::atomic<bool> done{false};
+
+        concurrency::run_threads(parallel::thread_pool::instance().size(), [&](std::size_t id){
+            std::uint64_t task;
+            std::size_t sum = 0;
+
+            if(id == 0){
+                for(std::size_t i = 0; i < size; ++i){
+                    deque.push(i);
+                    if(i % 100 >= Stolen && deque.pop(task)){
+                        sum += c[task].a;
+                    }
+                }
+
+                while(deque.pop(task)){
+                    sum += c[task].a;
+                }
+
+                done.store(true, std::memory_order_release);
+            } else {
+                while(!done.load(std::memory_order_acquire)){
+                    if(deque.steal(task)){
+                        sum += c[task].a;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            X.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+};
+
+template<class Container, template<class> class Deque, std::size_t Stolen>
+std::atomic<std::size_t> OwnerAndThieves<Container, Deque, Stolen>::X{0};
+
+template<class Container> using StealChaseLev0  = OwnerAndThieves<Container, parallel::chase_lev_deque, 0>;
+template<class Container> using StealChaseLev10 = OwnerAndThieves<Container, parallel::chase_lev_deque, 10>;
+template<class Container> using StealChaseLev50 = OwnerAndThieves<Container, parallel::chase_lev_deque, 50>;
+template<class Container> using StealChaseLev90 = OwnerAndThieves<Container, parallel::chase_lev_deque, 90>;
+template<class Container> using StealLocked0  = OwnerAndThieves<Container, parallel::locked_deque, 0>;
+template<class Container> using StealLocked10 = OwnerAndThieves<Container, parallel::locked_deque, 10>;
+template<class Container> using StealLocked50 = OwnerAndThieves<Container, parallel::locked_deque, 50>;
+template<class Container> using StealLocked90 = OwnerAndThieves<Container, parallel::locked_deque, 90>;
+
+// Recursive sum of the keys on a deque per thread: a range is split in halves
+// until it is small enough, the right halves being pushed to be stolen by the
+// idle threads. Ranges are packed in the 64 bits of the tasks.
+template<class Container, template<class> class Deque>
+struct ForkJoinSum {
+    static constexpr std::size_t grain = 2048;
+    static std::atomic<std::size_t> X;
+
+    inline static void run(Container &c, std::size_t){
+        const std::size_t threads = parallel::thread_pool::instance().size();
+
+        std::vector<std::unique_ptr<Deque<std::uint64_t>>> deques;
+        for(std::size_t i = 0; i < threads; ++i){
+            deques.push_back(std::make_unique<Deque<std::uint64_t>>());
+        }
+
+        std::atomic<std::size_t> remaining{c.size()};
+        deques[0]->push(std::uint64_t(c.size()) << 32);
+
+        concurrency::run_threads(threads, [&](std::size_t id){
+            auto &own = *deques[id];
+            std::minstd_rand victims(id + 1);
+            std::uint64_t task;
+            std::size_t sum = 0;
+
+            while(remaining.load(std::memory_order_acquire)){
+                if(!own.pop(task)){
+                    auto victim = victims() % threads;
+                    if(victim == id || !deques[victim]->steal(task)){
+                        std::this_thread::yield();
+                        continue;
+                    }
+                }
+
+                std::size_t begin = task & 0xFFFFFFFF;
+                std::size_t end = task >> 32;
+                while(end - begin > grain){
+                    auto middle = begin + (end - begin) / 2;
+                    own.push(std::uint64_t(end) << 32 | middle);
+                    end = middle;
+                }
+
+                for(auto i = begin; i < end; ++i){
+                    sum += c[i].a;
+                }
+
+                remaining.fetch_sub(end - begin, std::memory_order_release);
+            }
+
+            X.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+};
+
+template<class Container, template<class> class Deque>
+std::atomic<std::size_t> ForkJoinSum<Container, Deque>::X{0};
+
+template<class Container> using ForkJoinChaseLev = ForkJoinSum<Container, parallel::chase_lev_deque>;
+template<class Container> using ForkJoinLocked   = ForkJoinSum<Container, parallel::locked_deque>;
+
+// Operations on a concurrent map split between the threads, Reads% of them
+// are lookups and the others assignments, half of the keys are not in the
+// map at first so the assignments insert them
+template<class Container, std::size_t Reads>
+struct MapMix {
+    static constexpr std::size_t operations = 1 << 20;
+    static std::atomic<std::size_t> X;
+
+    inline static void run(Container &c, std::size_t size){
+        using T = typename Container::value_type;
+
+        const std::size_t threads = parallel::thread_pool::instance().size();
+
+        concurrency::run_threads(threads, [&](std::size_t id){
+            std::mt19937_64 generator(id);
+            std::uniform_int_distribution<std::size_t> keys(0, 2 * size - 1);
+            std::uniform_int_distribution<std::size_t> percent(0, 99);
+
+            T value{0};
+            std::size_t found = 0;
+            for(std::size_t i = id; i < operations; i += threads){
+                auto key = keys(generator);
+                if(percent(generator) < Reads){
+                    found += c.find(key, value);
+                } else {
+                    c.insert_or_assign(key, T{key});
+                }
+            }
+
+            X.fetch_add(found, std::memory_order_relaxed);
+        });
+    }
+};
+
+template<class Container, std::size_t Reads>
+std::atomic<std::size_t> MapMix<Container, Reads>::X{0};
+
+template<class Container> using ReadHeavy   = MapMix<Container, 95>;
+template<class Container> using Balanced    = MapMix<Container, 50>;
+template<class Container> using WriteHeavy  = MapMix<Container, 5>;
+
+// Replay the operations of the current trace, the size is tracked since
+// forward_list doesn't know it
+template<class Container>
+struct Replay {
+    static std::size_t X;
+    inline static void run(Container &c, std::size_t size){
+        using T = typename Container::value_type;
+
+        for(auto &r : trace::current()){
+            switch(r.operation){
+                case trace::op::PUSH_BACK:
+                    // at the front for forward_list, its series says so
+                    container_push_value(c, r.key);
+                    ++size;
+                    break;
+                case trace::op::PUSH_FRONT:
+                    if constexpr (is_vector<Container>()) {
+                        c.insert(c.begin(), T{r.key});
+                    } else {
+                        c.push_front(T{r.key});
+                    }
+                    ++size;
+                    break;
+                case trace::op::INSERT:
+                    if constexpr (is_forward_list<Container>()) {
+                        c.insert_after(std::next(c.before_begin(), trace::index(r.position, size + 1)), T{r.key});
+                    } else {
+                        c.insert(std::next(c.begin(), trace::index(r.position, size + 1)), T{r.key});
+                    }
+                    ++size;
+                    break;
+                case trace::op::ERASE:
+                    if(size){
+                        if constexpr (is_forward_list<Container>()) {
+                            c.erase_after(std::next(c.before_begin(), trace::index(r.position, size)));
+                        } else {
+                            c.erase(std::next(c.begin(), trace::index(r.position, size)));
+                        }
+                        --size;
+                    }
+                    break;
+                case trace::op::FIND:
+                    // hand written comparison to eliminate temporary object creation
+                    if(std::find_if(c.begin(), c.end(), [&](const T &v){ return v.a == r.key; }) != c.end()){
+                        ++X;
+                    }
+                    break;
+                case trace::op::ITERATE:
+                    for(auto &v : c){
+                        X += v.a;
+                    }
+                    break;
+            }
+        }
+    }
+};
+
+template<class Container>
+std::size_t Replay<Container>::X = 0;
+
+// Push the prepared keys
+template<class Heap>
+struct HeapPush {
+    inline static void run(Heap &c, std::size_t){
+        for(auto &value : HeapKeys<Heap>::v){
+            c.push(value);
+        }
+    }
+};
+
+// Pop all the elements in order
+template<class Heap>
+struct HeapPop {
+    static std::size_t X;
+    inline static void run(Heap &c, std::size_t){
+        while(!c.empty()){
+            X += c.top().a;
+            c.pop();
+        }
+    }
+};
+
+template<class Heap>
+std::size_t HeapPop<Heap>::X = 0;
+
+// Event simulation at a steady size: the earliest event is popped and an
+// event later in time is pushed, the keys are monotone
+template<class Heap>
+struct HeapPushPop {
+    static std::size_t X;
+    inline static void run(Heap &c, std::size_t size){
+        using T = typename Heap::value_type;
+
+        std::mt19937_64 generator;
+        std::uniform_int_distribution<std::size_t> delay(1, size);
+
+        for(std::size_t i = 0; i < size; ++i){
+            std::size_t time = c.top().a;
+            c.pop();
+            c.push(T{time + delay(generator)});
+            X += time;
+        }
+    }
+};
+
+template<class Heap>
+std::size_t HeapPushPop<Heap>::X = 0;
+
+// Decrease the key of random elements to three quarters of it, the heaps
+// without decrease-key push a new element instead and would skip the stale
+// one when it is popped
+template<class Heap>
+struct HeapDecreaseKey {
+    inline static void run(Heap &c, std::size_t size){
+        using T = typename Heap::value_type;
+
+        std::mt19937_64 generator;
+        std::uniform_int_distribution<std::size_t> element(0, size - 1);
+
+        for(std::size_t i = 0; i < size; ++i){
+            auto j = element(generator);
+            if constexpr (heaps::has_decrease_key<Heap>::value) {
+                auto h = HeapHandles<Heap>::v[j];
+                std::size_t key = Heap::value(h).a;
+                c.decrease_key(h, T{key - key / 4});
+            } else {
+                std::size_t key = HeapKeys<Heap>::v[j].a;
+                c.push(T{key - key / 4});
+            }
+        }
+    }
+};
+
+// Build the heap at once from the random keys
+template<class Heap>
+struct Heapify {
+    inline static void run(Heap &c, std::size_t){
+        c = Heap(HeapKeys<Heap>::v.begin(), HeapKeys<Heap>::v.end());
+    }
+};
+
+// Look up each key of the stream, loading the missing ones in the cache, the
+// hits are counted for bench_hit_rate()
+template<class Cache, class Keys>
+struct CacheRequests {
+    static std::size_t requests;
+    static std::size_t hits;
+    static std::size_t X;
+
+    inline static void run(Cache &c, std::size_t){
+        using T = typename Cache::value_type;
+
+        for(auto key : RequestStream<Keys>::v){
+            if(auto value = c.get(key)){
+                X += value->a;
+                ++hits;
+            } else {
+                c.put(key, T{key});
+            }
+        }
+
+        requests += RequestStream<Keys>::v.size();
+    }
+};
+
+template<class Cache, class Keys>
+std::size_t CacheRequests<Cache, Keys>::requests = 0;
+
+template<class Cache, class Keys>
+std::size_t CacheRequests<Cache, Keys>::hits = 0;
+
+template<class Cache, class Keys>
+std::size_t CacheRequests<Cache, Keys>::X = 0;
+
+template<class Cache> using CacheRequestsUniform = CacheRequests<Cache, UniformKeys>;
+template<class Cache> using CacheRequestsZipf    = CacheRequests<Cache, ZipfKeys>;
+
 template<class Container>
 struct IterateAndClear : Iterate<Container> {
     inline static void run(Container &c, std::size_t size){
@@ -462,15 +1693,20 @@ struct IterateAndClear : Iterate<Container> {
 
 template<class Container> using IterateAndClearShrink = Shrink<Container, IterateAndClear>;
 
+// Erase the keys prepared by FilledRandomErasures
 template<class Container>
 struct Erase {
     inline static void run(Container &c, std::size_t){
-        for(std::size_t i=0; i<1000; ++i) {
+        for(auto key : FilledRandomErasures<Container>::keys) {
             // hand written comparison to eliminate temporary object creation
-            if constexpr (!has_random_insert<Container>())
-                c.remove_if([&](decltype(*begin(c)) v){ return v.a == i; });
-            else
-                c.erase(std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a == i; }));
+            if constexpr (!has_random_insert<Container>()) {
+                c.remove_if([&](decltype(*begin(c)) v){ return v.a == key; });
+            } else {
+                // drawn keys may have been erased already
+                auto it = std::find_if(std::begin(c), std::end(c), [&](decltype(*std::begin(c)) v){ return v.a == key; });
+                if(it != std::end(c))
+                    c.erase(it);
+            }
         }
     }
 };
@@ -596,129 +1832,482 @@ struct EraseMiddleSwap : SwapAndErase<Container> {
     }
 };
 
-template<class Container> using EraseMiddleSwapShrink = Shrink<Container, EraseMiddleSwap>;
+template<class Container> using EraseMiddleSwapShrink = Shrink<Container, EraseMiddleSwap>;
+
+template<class Container>
+struct EraseMiddleValue : EraseValue<Container> {
+    inline static void run(Container &c, std::size_t size){
+        EraseValue<Container>::run(c, size/2);
+    }
+};
+
+template<class Container> using EraseMiddleValueShrink = Shrink<Container, EraseMiddleValue>;
+
+template<class Container>
+struct EraseMiddleValueSwap : EraseValue<Container>, SwapAndErase<Container> {
+    inline static void run(Container &c, std::size_t size) {
+        SwapAndErase<Container>::run(c, find_value<Container>(c, size/2));
+    }
+};
+
+template<class Container> using EraseMiddleValueSwapShrink = Shrink<Container, EraseMiddleValueSwap>;
+
+template<class Container>
+struct EraseBack {
+    inline static void run(Container &c, std::size_t){
+        if constexpr (is_forward_list<Container>()) {
+            auto it_before = c.before_begin();
+            auto it_next = c.begin();
+            for (++it_next; it_next != c.end(); ++it_next) {
+                it_before++;
+            }
+
+            c.erase_after(it_before);
+        }
+        else {
+            c.pop_back();
+        }
+    }
+};
+
+template<class Container> using EraseBackShrink = Shrink<Container, EraseBack>;
+
+template<class Container>
+struct EraseBackSwap : SwapAndErase<Container> {
+    inline static void run(Container &c, std::size_t){
+        SwapAndErase<Container>::run(c, c.rbegin());
+    }
+};
+
+template<class Container> using EraseBackSwapShrink = Shrink<Container, EraseBackSwap>;
+
+template<class Container>
+struct EraseBackValue : EraseValue<Container> {
+    inline static void run(Container &c, std::size_t size){
+        EraseValue<Container>::run(c, size-1);
+    }
+};
+
+template<class Container> using EraseBackValueShrink = Shrink<Container, EraseBackValue>;
+
+template<class Container>
+struct EraseBackValueSwap : EraseValue<Container>, SwapAndErase<Container> {
+    inline static void run(Container &c, std::size_t) {
+        SwapAndErase<Container>::run(c, find_value<Container>(c, c.back().a));
+    }
+};
+
+template<class Container> using EraseBackValueSwapShrink = Shrink<Container, EraseBackValueSwap>;
+
+//Sort the container
+
+template<class Container>
+struct Sort {
+    inline static void run(Container &c, std::size_t){
+        std::sort(c.begin(), c.end());
+    }
+};
+
+template<class T>
+struct Sort<std::list<T> > {
+    inline static void run(std::list<T> &c, std::size_t){
+        c.sort();
+    }
+};
+
+template<class T>
+struct Sort<indirect::pointer_vector<T> > {
+    inline static void run(indirect::pointer_vector<T> &c, std::size_t){
+        c.sort();
+    }
+};
+
+template<class T>
+struct Sort<indirect::pool_vector<T> > {
+    inline static void run(indirect::pool_vector<T> &c, std::size_t){
+        c.sort();
+    }
+};
+
+// Sort the keys with the positions of their elements, then move each element
+// once, following the cycles of the permutation
+template<class Container>
+struct SortByKey {
+    inline static void run(Container &c, std::size_t){
+        std::vector<std::pair<std::size_t, std::size_t>> keys;
+        keys.reserve(c.size());
+        for(std::size_t i = 0; i < c.size(); ++i){
+            keys.emplace_back(c[i].a, i);
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        // keys[i].second is the position of the element going to i, set to i
+        // once it is there
+        for(std::size_t i = 0; i < keys.size(); ++i){
+            if(keys[i].second == i){
+                continue;
+            }
+
+            auto value = std::move(c[i]);
+            auto j = i;
+            while(keys[j].second != i){
+                auto next = keys[j].second;
+                c[j] = std::move(c[next]);
+                keys[j].second = j;
+                j = next;
+            }
+
+            c[j] = std::move(value);
+            keys[j].second = j;
+        }
+    }
+};
+
+//Sort the container by radix of the integer key
+
+template<class Container, unsigned Bits>
+struct LSDRadixSort {
+    inline static void run(Container &c, std::size_t){
+        radix::lsd_sort<Bits>(c.begin(), c.end());
+    }
+};
+
+template<class Container> using RadixSort8  = LSDRadixSort<Container, 8>;
+template<class Container> using RadixSort11 = LSDRadixSort<Container, 11>;
+template<class Container> using RadixSort16 = LSDRadixSort<Container, 16>;
+
+template<class Container>
+struct AmericanFlagSort {
+    inline static void run(Container &c, std::size_t){
+        radix::american_flag_sort(c.begin(), c.end());
+    }
+};
+
+//Sort the container on the threads of the pool
+
+template<class Container>
+struct ParallelMergeSort {
+    inline static void run(Container &c, std::size_t){
+        parallel::merge_sort(c.begin(), c.end());
+    }
+};
+
+#ifdef BENCH_HAVE_TBB
+template<class Container>
+struct ParallelStdSort {
+    inline static void run(Container &c, std::size_t){
+        std::sort(std::execution::par, c.begin(), c.end());
+    }
+};
+#endif
+
+template<class Container>
+struct TimSort {
+    inline static void run(Container &c, std::size_t){
+        c.timsort();
+    }
+};
+
+//Reverse the container
+
+// The algorithms run sequentially, or with the execution policy given as
+// Execution. The member functions of the lists are used when they exist.
+
+// The policy is passed as an lvalue, like std::execution::par_unseq, since the
+// parallel nth_element of libstdc++ 12 does not accept an rvalue
+template<typename Execution>
+inline constexpr Execution execution_policy{};
+
+template<class Container, typename... Execution>
+struct Reverse {
+    inline static void run(Container &c, std::size_t){
+        std::reverse(execution_policy<Execution>..., c.begin(), c.end());
+    }
+};
+
+template<class T>
+struct Reverse<std::list<T> > {
+    inline static void run(std::list<T> &c, std::size_t){
+        c.reverse();
+    }
+};
+
+template<class T>
+struct Reverse<std::forward_list<T> > {
+    inline static void run(std::forward_list<T> &c, std::size_t){
+        c.reverse();
+    }
+};
 
-template<class Container>
-struct EraseMiddleValue : EraseValue<Container> {
+// Move the first half after the second one
+template<class Container, typename... Execution>
+struct Rotate {
     inline static void run(Container &c, std::size_t size){
-        EraseValue<Container>::run(c, size/2);
+        std::rotate(execution_policy<Execution>..., c.begin(), std::next(c.begin(), size / 2), c.end());
     }
 };
 
-template<class Container> using EraseMiddleValueShrink = Shrink<Container, EraseMiddleValue>;
-
-template<class Container>
-struct EraseMiddleValueSwap : EraseValue<Container>, SwapAndErase<Container> {
-    inline static void run(Container &c, std::size_t size) {
-        SwapAndErase<Container>::run(c, find_value<Container>(c, size/2));
+template<class T>
+struct Rotate<std::list<T> > {
+    inline static void run(std::list<T> &c, std::size_t size){
+        c.splice(c.end(), c, c.begin(), std::next(c.begin(), size / 2));
     }
 };
 
-template<class Container> using EraseMiddleValueSwapShrink = Shrink<Container, EraseMiddleValueSwap>;
-
-template<class Container>
-struct EraseBack {
-    inline static void run(Container &c, std::size_t){
-        decltype(c.begin()) it;
-        if constexpr (is_forward_list<Container>()) {
-            auto it_before = c.before_begin();
-            auto it_next = c.begin();
-            for (++it_next; it_next != c.end(); ++it_next) {
-                it_before++;
-            }
-
-            c.erase_after(it_before);
-        }
-        else {
-            c.pop_back();
+template<class T>
+struct Rotate<std::forward_list<T> > {
+    inline static void run(std::forward_list<T> &c, std::size_t size){
+        // the last elements of the halves
+        auto half = std::next(c.before_begin(), size / 2);
+        auto last = half;
+        while(std::next(last) != c.end()){
+            ++last;
         }
+
+        c.splice_after(last, c, c.before_begin(), std::next(half));
     }
 };
 
-template<class Container> using EraseBackShrink = Shrink<Container, EraseBack>;
+struct is_even {
+    template<typename T>
+    bool operator()(const T &value) const { return value.a % 2 == 0; }
+};
 
-template<class Container>
-struct EraseBackSwap : SwapAndErase<Container> {
+struct same_key {
+    template<typename T>
+    bool operator()(const T &lhs, const T &rhs) const { return lhs.a == rhs.a; }
+};
+
+template<class Container, typename... Execution>
+struct Partition {
     inline static void run(Container &c, std::size_t){
-        SwapAndErase<Container>::run(c, c.rbegin());
+        std::partition(execution_policy<Execution>..., c.begin(), c.end(), is_even());
     }
 };
 
-template<class Container> using EraseBackSwapShrink = Shrink<Container, EraseBackSwap>;
-
-template<class Container>
-struct EraseBackValue : EraseValue<Container> {
-    inline static void run(Container &c, std::size_t size){
-        EraseValue<Container>::run(c, size-1);
+template<class Container, typename... Execution>
+struct StablePartition {
+    inline static void run(Container &c, std::size_t){
+        std::stable_partition(execution_policy<Execution>..., c.begin(), c.end(), is_even());
     }
 };
 
-template<class Container> using EraseBackValueShrink = Shrink<Container, EraseBackValue>;
+template<class Container, typename... Execution>
+struct Unique {
+    inline static void run(Container &c, std::size_t){
+        c.erase(std::unique(execution_policy<Execution>..., c.begin(), c.end(), same_key()), c.end());
+    }
+};
 
-template<class Container>
-struct EraseBackValueSwap : EraseValue<Container>, SwapAndErase<Container> {
-    inline static void run(Container &c, std::size_t) {
-        SwapAndErase<Container>::run(c, find_value<Container>(c, c.back().a));
+template<class T>
+struct Unique<std::list<T> > {
+    inline static void run(std::list<T> &c, std::size_t){
+        c.unique(same_key());
     }
 };
 
-template<class Container> using EraseBackValueSwapShrink = Shrink<Container, EraseBackValueSwap>;
+template<class T>
+struct Unique<std::forward_list<T> > {
+    inline static void run(std::forward_list<T> &c, std::size_t){
+        c.unique(same_key());
+    }
+};
 
-//Sort the container
+template<class Container, typename... Execution>
+struct NthElement {
+    inline static void run(Container &c, std::size_t size){
+        std::nth_element(execution_policy<Execution>..., c.begin(), c.begin() + size / 2, c.end());
+    }
+};
 
-template<class Container>
-struct Sort {
+template<class Container, typename... Execution>
+struct StableSort {
     inline static void run(Container &c, std::size_t){
-        std::sort(c.begin(), c.end());
+        std::stable_sort(execution_policy<Execution>..., c.begin(), c.end());
     }
 };
 
 template<class T>
-struct Sort<std::list<T> > {
+struct StableSort<std::list<T> > {
     inline static void run(std::list<T> &c, std::size_t){
         c.sort();
     }
 };
 
+template<class T>
+struct StableSort<std::forward_list<T> > {
+    inline static void run(std::forward_list<T> &c, std::size_t){
+        c.sort();
+    }
+};
+
 template<class Container>
-struct TimSort {
+struct Accumulate {
+    static size_t X;
     inline static void run(Container &c, std::size_t){
-        c.timsort();
+        X += std::accumulate(c.begin(), c.end(), std::size_t(0), [](std::size_t sum, const auto &value){ return sum + value.a; });
     }
 };
 
-//Reverse the container
-
 template<class Container>
-struct Reverse {
+size_t Accumulate<Container>::X = 0;
+
+template<class Container, typename... Execution>
+struct TransformReduce {
+    static size_t X;
     inline static void run(Container &c, std::size_t){
-        std::reverse(c.begin(), c.end());
+        X += std::transform_reduce(execution_policy<Execution>..., c.begin(), c.end(), std::size_t(0), std::plus<>(), [](const auto &value){ return value.a; });
+    }
+};
+
+template<class Container, typename... Execution>
+size_t TransformReduce<Container, Execution...>::X = 0;
+
+// Merge the two containers of FilledSortedPair in a new one, the parallel
+// algorithms need the output to be allocated beforehand
+template<class Pair, typename... Execution>
+struct Merge {
+    using Container = typename Pair::first_type;
+    inline static void run(Pair &c, std::size_t){
+        if constexpr (sizeof...(Execution) > 0) {
+            Container merged(c.first.size() + c.second.size());
+            std::merge(execution_policy<Execution>..., c.first.begin(), c.first.end(), c.second.begin(), c.second.end(), merged.begin());
+            c.first.swap(merged);
+        } else {
+            Container merged;
+            std::merge(c.first.begin(), c.first.end(), c.second.begin(), c.second.end(), std::back_inserter(merged));
+            c.first.swap(merged);
+        }
     }
 };
 
+// Only the nodes are relinked
 template<class T>
-struct Reverse<std::list<T> > {
-    inline static void run(std::list<T> &c, std::size_t){
-        c.reverse();
+struct Merge<std::pair<std::list<T>, std::list<T>>> {
+    inline static void run(std::pair<std::list<T>, std::list<T>> &c, std::size_t){
+        c.first.merge(c.second);
+    }
+};
+
+template<class T>
+struct Merge<std::pair<std::forward_list<T>, std::forward_list<T>>> {
+    inline static void run(std::pair<std::forward_list<T>, std::forward_list<T>> &c, std::size_t){
+        c.first.merge(c.second);
+    }
+};
+
+template<class Pair, typename... Execution>
+struct SetIntersection {
+    using Container = typename Pair::first_type;
+    static size_t X;
+    inline static void run(Pair &c, std::size_t){
+        if constexpr (sizeof...(Execution) > 0) {
+            Container common(std::min(c.first.size(), c.second.size()));
+            auto last = std::set_intersection(execution_policy<Execution>..., c.first.begin(), c.first.end(), c.second.begin(), c.second.end(), common.begin());
+            common.erase(last, common.end());
+            X += common.size();
+        } else {
+            Container common;
+            std::set_intersection(c.first.begin(), c.first.end(), c.second.begin(), c.second.end(), std::back_inserter(common));
+            X += common.size();
+        }
     }
 };
 
+template<class Pair, typename... Execution>
+size_t SetIntersection<Pair, Execution...>::X = 0;
+
+#ifdef BENCH_HAVE_TBB
+template<class Container> using ReverseParUnseq         = Reverse<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using RotateParUnseq          = Rotate<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using PartitionParUnseq       = Partition<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using StablePartitionParUnseq = StablePartition<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using UniqueParUnseq          = Unique<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using NthElementParUnseq      = NthElement<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using StableSortParUnseq      = StableSort<Container, std::execution::parallel_unsequenced_policy>;
+template<class Container> using TransformReduceParUnseq = TransformReduce<Container, std::execution::parallel_unsequenced_policy>;
+template<class Pair>      using MergeParUnseq           = Merge<Pair, std::execution::parallel_unsequenced_policy>;
+template<class Pair>      using SetIntersectionParUnseq = SetIntersection<Pair, std::execution::parallel_unsequenced_policy>;
+#endif
+
 //Destroy the container
 
+// Run a filling policy one element at a time and record the duration of each
+// call in the latency histogram
+template<class Container, template<class> class Fill>
+struct TimedFill {
+    inline static void run(Container &c, std::size_t size){
+        auto &histogram = latency::current();
+        for(std::size_t i=0; i<size; ++i){
+            auto t0 = latency::ticks();
+            Fill<Container>::run(c, 1);
+            histogram.record(latency::ticks() - t0);
+        }
+    }
+};
+
+template<class Container> using TimedFillBack    = TimedFill<Container, FillBack>;
+template<class Container> using TimedEmplaceBack = TimedFill<Container, EmplaceBack>;
+template<class Container> using TimedFillFront   = TimedFill<Container, FillFront>;
+
+// Run a single erasure policy on the first elements and record the duration
+// of each call in the latency histogram, the current size is given to it
+template<class Container, template<class> class Erasure>
+struct TimedErase {
+    static constexpr std::size_t operations = 1000;
+    inline static void run(Container &c, std::size_t size){
+        auto &histogram = latency::current();
+        for(std::size_t i=0; i<std::min(operations, size); ++i){
+            auto t0 = latency::ticks();
+            Erasure<Container>::run(c, size - i);
+            histogram.record(latency::ticks() - t0);
+        }
+    }
+};
+
+template<class Container> using TimedEraseFront  = TimedErase<Container, EraseFront>;
+template<class Container> using TimedEraseMiddle = TimedErase<Container, EraseMiddle>;
+template<class Container> using TimedEraseBack   = TimedErase<Container, EraseBack>;
+
 template<class Container>
 struct SmartDelete {
     inline static void run(Container &c, std::size_t) { c.reset(); }
 };
 
+// Whole container operations on the pairs of FilledPair
+
+template<class Pair>
+struct CopyConstruct {
+    inline static void run(Pair &c, std::size_t) { c.second.emplace(c.first); }
+};
+
+template<class Pair>
+struct CopyAssign {
+    inline static void run(Pair &c, std::size_t) { *c.second = c.first; }
+};
+
+template<class Pair>
+struct MoveConstruct {
+    inline static void run(Pair &c, std::size_t) { c.second.emplace(std::move(c.first)); }
+};
+
+template<class Pair>
+struct MoveAssign {
+    inline static void run(Pair &c, std::size_t) { *c.second = std::move(c.first); }
+};
+
+template<class Pair>
+struct Swap {
+    inline static void run(Pair &c, std::size_t) { c.first.swap(*c.second); }
+};
+
+// Insert the keys prepared by EmptyPrepareRandomKeys in order
 template<class Container>
 struct RandomSortedInsert {
-    static std::mt19937 generator;
-    static std::uniform_int_distribution<std::size_t> distribution;
-
-    inline static void run(Container &c, std::size_t size){
+    inline static void run(Container &c, std::size_t){
         if constexpr (has_random_insert<Container>()) {
-            for(std::size_t i=0; i<size; ++i){
-                auto val = distribution(generator);
+            for(auto val : EmptyPrepareRandomKeys<Container>::keys){
                 // hand written comparison to eliminate temporary object creation
                 c.insert(std::find_if(begin(c), end(c), [&](decltype(*begin(c)) v){ return v.a >= val; }), {val});
             }
@@ -726,15 +2315,10 @@ struct RandomSortedInsert {
     }
 };
 
-template<class Container> std::mt19937 RandomSortedInsert<Container>::generator;
-template<class Container> std::uniform_int_distribution<std::size_t> RandomSortedInsert<Container>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
-
 template<class Container>
 struct RandomErase1 {
-    static std::mt19937 generator;
-    static std::uniform_int_distribution<std::size_t> distribution;
-
-    inline static void run(Container &c, std::size_t /*size*/){
+    inline static void run(Container &c, std::size_t){
+        auto &drawn = FilledRandomDrawn1<Container>::drawn;
         auto it = c.begin();
         decltype(c.begin()) before;
 
@@ -742,7 +2326,7 @@ struct RandomErase1 {
             before = c.before_begin();
 
         while(it != c.end()){
-            if(distribution(generator) > 9900){
+            if(drawn[it->a]){
                 if constexpr (is_forward_list<Container>())
                     it = c.erase_after(before);
                 else
@@ -758,16 +2342,12 @@ struct RandomErase1 {
     }
 };
 
-template<class Container> std::mt19937 RandomErase1<Container>::generator;
-template<class Container> std::uniform_int_distribution<std::size_t> RandomErase1<Container>::distribution(0, 10000);
 template<class Container> using RandomErase1Shrink = Shrink<Container, RandomErase1>;
 
 template<class Container>
 struct RandomErase10 {
-    static std::mt19937 generator;
-    static std::uniform_int_distribution<std::size_t> distribution;
-
-    inline static void run(Container &c, std::size_t /*size*/){
+    inline static void run(Container &c, std::size_t){
+        auto &drawn = FilledRandomDrawn10<Container>::drawn;
         auto it = c.begin();
         decltype(c.begin()) before;
 
@@ -775,7 +2355,7 @@ struct RandomErase10 {
             before = c.before_begin();
 
         while(it != c.end()){
-            if(distribution(generator) > 9000){
+            if(drawn[it->a]){
                 if constexpr (is_forward_list<Container>())
                     it = c.erase_after(before);
                 else
@@ -788,16 +2368,12 @@ struct RandomErase10 {
     }
 };
 
-template<class Container> std::mt19937 RandomErase10<Container>::generator;
-template<class Container> std::uniform_int_distribution<std::size_t> RandomErase10<Container>::distribution(0, 10000);
 template<class Container> using RandomErase10Shrink = Shrink<Container, RandomErase10>;
 
 template<class Container>
 struct RandomErase25 {
-    static std::mt19937 generator;
-    static std::uniform_int_distribution<std::size_t> distribution;
-
-    inline static void run(Container &c, std::size_t /*size*/){
+    inline static void run(Container &c, std::size_t){
+        auto &drawn = FilledRandomDrawn25<Container>::drawn;
         auto it = c.begin();
         decltype(c.begin()) before;
 
@@ -805,7 +2381,7 @@ struct RandomErase25 {
             before = c.before_begin();
 
         while(it != c.end()){
-            if(distribution(generator) > 7500){
+            if(drawn[it->a]){
                 if constexpr (is_forward_list<Container>())
                     it = c.erase_after(before);
                 else
@@ -818,15 +2394,11 @@ struct RandomErase25 {
     }
 };
 
-template<class Container> std::mt19937 RandomErase25<Container>::generator;
-template<class Container> std::uniform_int_distribution<std::size_t> RandomErase25<Container>::distribution(0, 10000);
 
 template<class Container>
 struct RandomErase50 {
-    static std::mt19937 generator;
-    static std::uniform_int_distribution<std::size_t> distribution;
-
-    inline static void run(Container &c, std::size_t /*size*/){
+    inline static void run(Container &c, std::size_t){
+        auto &drawn = FilledRandomDrawn50<Container>::drawn;
         auto it = c.begin();
         decltype(c.begin()) before;
 
@@ -834,7 +2406,7 @@ struct RandomErase50 {
             before = c.before_begin();
 
         while(it != c.end()){
-            if(distribution(generator) > 5000){
+            if(drawn[it->a]){
                 if constexpr (is_forward_list<Container>())
                     it = c.erase_after(before);
                 else
@@ -847,8 +2419,6 @@ struct RandomErase50 {
     }
 };
 
-template<class Container> std::mt19937 RandomErase50<Container>::generator;
-template<class Container> std::uniform_int_distribution<std::size_t> RandomErase50<Container>::distribution(0, 10000);
 
 template<class Container>
 struct FullErase {
@@ -882,3 +2452,254 @@ struct Traversal {
         }
     }
 };
+
+// Visitors of the elements for the list traversal policies
+
+struct ReadKey {
+    inline static std::size_t X = 0;
+    template<typename T>
+    inline static void visit(T &v){ X += v.a; }
+};
+
+struct WriteKey {
+    template<typename T>
+    inline static void visit(T &v){ ++v.a; }
+};
+
+//Traverse a single list prefetching the node Distance positions ahead
+
+template<class Container, std::size_t Distance, class Visitor>
+struct PrefetchVisit {
+    inline static void run(Container &c, std::size_t){
+        auto ahead = c.begin();
+        for(std::size_t i = 0; i < Distance && ahead != c.end(); ++i){
+            ++ahead;
+        }
+
+        for(auto it = c.begin(); it != c.end(); ++it){
+            if constexpr (Distance > 0) {
+                if(ahead != c.end()){
+                    __builtin_prefetch(&*ahead);
+                    ++ahead;
+                }
+            }
+
+            Visitor::visit(*it);
+        }
+    }
+};
+
+template<class Container> using PrefetchIterate0  = PrefetchVisit<Container, 0, ReadKey>;
+template<class Container> using PrefetchIterate4  = PrefetchVisit<Container, 4, ReadKey>;
+template<class Container> using PrefetchIterate16 = PrefetchVisit<Container, 16, ReadKey>;
+template<class Container> using PrefetchWrite0    = PrefetchVisit<Container, 0, WriteKey>;
+template<class Container> using PrefetchWrite4    = PrefetchVisit<Container, 4, WriteKey>;
+template<class Container> using PrefetchWrite16   = PrefetchVisit<Container, 16, WriteKey>;
+
+// Index the elements Step by Step, in as many sweeps as needed to visit all
+// of them once
+
+template<class Container, std::size_t Step, class Visitor>
+struct StrideVisit {
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t first = 0; first < Step && first < size; ++first){
+            for(std::size_t i = first; i < size; i += Step){
+                Visitor::visit(c[i]);
+            }
+        }
+    }
+};
+
+// One element by page
+template<class Container>
+constexpr std::size_t page_step(){
+    return std::max<std::size_t>(1, 4096 / sizeof(typename Container::value_type));
+}
+
+template<class Container> using IndexIterate = StrideVisit<Container, 1, ReadKey>;
+template<class Container> using Stride2      = StrideVisit<Container, 2, ReadKey>;
+template<class Container> using Stride8      = StrideVisit<Container, 8, ReadKey>;
+template<class Container> using Stride64     = StrideVisit<Container, 64, ReadKey>;
+template<class Container> using StridePage   = StrideVisit<Container, page_step<Container>(), ReadKey>;
+
+// Index the elements at the random positions prepared by FilledRandomIndices
+template<class Container, class Visitor>
+struct IndicesVisit {
+    inline static void run(Container &c, std::size_t){
+        for(auto i : FilledRandomIndices<Container>::indices){
+            Visitor::visit(c[i]);
+        }
+    }
+};
+
+template<class Container> using Gather  = IndicesVisit<Container, ReadKey>;
+template<class Container> using Scatter = IndicesVisit<Container, WriteKey>;
+
+template<class Container, std::size_t Distance>
+struct PrefetchFind {
+    static size_t X;
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i) {
+            auto ahead = c.begin();
+            for(std::size_t d = 0; d < Distance && ahead != c.end(); ++d){
+                ++ahead;
+            }
+
+            auto it = c.begin();
+            for(; it != c.end() && it->a != i; ++it){
+                if(ahead != c.end()){
+                    __builtin_prefetch(&*ahead);
+                    ++ahead;
+                }
+            }
+
+            if(it == c.end()){
+                ++X;
+            }
+        }
+    }
+};
+
+template<class Container, std::size_t Distance>
+size_t PrefetchFind<Container, Distance>::X = 0;
+
+template<class Container> using PrefetchFind4  = PrefetchFind<Container, 4>;
+template<class Container> using PrefetchFind16 = PrefetchFind<Container, 16>;
+
+//Traverse the independent lists of FilledRandomLists one after the other
+
+template<class Container, class Visitor>
+struct SequentialLists {
+    inline static void run(Container &c, std::size_t){
+        for(auto &list : c){
+            for(auto &v : list){
+                Visitor::visit(v);
+            }
+        }
+    }
+};
+
+template<class Container> using SequentialListsIterate = SequentialLists<Container, ReadKey>;
+template<class Container> using SequentialListsWrite   = SequentialLists<Container, WriteKey>;
+
+//Traverse the independent lists of FilledRandomLists at once, as in
+//asynchronous memory access chaining (AMAC): each list is a lane of a state
+//machine and a lane prefetches its next node before yielding to the next
+//lane, so that the cache misses of all the lanes overlap
+
+template<class Container, class Visitor>
+struct InterleavedLists {
+    inline static void run(Container &c, std::size_t){
+        using iterator = typename Container::value_type::iterator;
+
+        std::array<iterator, std::tuple_size<Container>::value> it;
+        std::array<iterator, std::tuple_size<Container>::value> end;
+
+        std::size_t active = 0;
+        for(auto &list : c){
+            if(list.begin() != list.end()){
+                it[active] = list.begin();
+                end[active] = list.end();
+                ++active;
+            }
+        }
+
+        while(active){
+            for(std::size_t j = 0; j < active;){
+                Visitor::visit(*it[j]);
+
+                if(++it[j] == end[j]){
+                    // the lane is over, the last one takes its place
+                    --active;
+                    it[j] = it[active];
+                    end[j] = end[active];
+                    continue;
+                }
+
+                __builtin_prefetch(&*it[j]);
+                ++j;
+            }
+        }
+    }
+};
+
+template<class Container> using InterleavedListsIterate = InterleavedLists<Container, ReadKey>;
+template<class Container> using InterleavedListsWrite   = InterleavedLists<Container, WriteKey>;
+
+//Look for each key in the list with the same index modulo the number of lists
+
+template<class Container>
+struct SequentialListsFind {
+    static size_t X;
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i) {
+            auto &list = c[i % c.size()];
+            // hand written comparison to eliminate temporary object creation
+            if(std::find_if(list.begin(), list.end(), [&](decltype(*list.begin()) v){ return v.a == i; }) == list.end()){
+                ++X;
+            }
+        }
+    }
+};
+
+template<class Container>
+size_t SequentialListsFind<Container>::X = 0;
+
+//Same lookups as SequentialListsFind, with one lookup in flight per lane and
+//lanes starting the next lookup as soon as theirs is over
+
+template<class Container>
+struct InterleavedListsFind {
+    static size_t X;
+    inline static void run(Container &c, std::size_t size){
+        using iterator = typename Container::value_type::iterator;
+
+        struct lane {
+            iterator it;
+            iterator end;
+            std::size_t key;
+        };
+
+        std::array<lane, std::tuple_size<Container>::value> lanes;
+        std::size_t next = 0;
+
+        auto start = [&](lane &l){
+            auto &list = c[next % c.size()];
+            l = {list.begin(), list.end(), next};
+            ++next;
+        };
+
+        std::size_t active = 0;
+        while(active < lanes.size() && next < size){
+            start(lanes[active++]);
+        }
+
+        while(active){
+            for(std::size_t j = 0; j < active;){
+                auto &l = lanes[j];
+
+                if(l.it == l.end || l.it->a == l.key){
+                    if(l.it == l.end){
+                        ++X;
+                    }
+
+                    if(next < size){
+                        start(l);
+                        ++j;
+                    } else {
+                        l = lanes[--active];
+                    }
+                    continue;
+                }
+
+                if(++l.it != l.end){
+                    __builtin_prefetch(&*l.it);
+                }
+                ++j;
+            }
+        }
+    }
+};
+
+template<class Container>
+size_t InterleavedListsFind<Container>::X = 0;
@@ -0,0 +1,260 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_QUEUES
+#define ARTICLES_QUEUES
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Work queues shared between threads. All of them expose try_push() and
+// try_pop(), which fail instead of blocking when the queue is full or empty,
+// and tell how many producers and consumers they support.
+
+namespace queues {
+
+constexpr std::size_t cache_line = 64;
+
+inline std::size_t round_up_pow2(std::size_t n){
+    std::size_t p = 2;
+    while(p < n){
+        p *= 2;
+    }
+    return p;
+}
+
+// Standard container behind a mutex, unbounded
+template<typename T, typename Container = std::deque<T>>
+class locked_queue {
+    public:
+        using value_type = T;
+
+        static constexpr bool multi_producer = true;
+        static constexpr bool multi_consumer = true;
+
+        explicit locked_queue(std::size_t) {}
+
+        bool try_push(const T &value){
+            std::lock_guard<std::mutex> lock(mutex);
+            container.push_back(value);
+            return true;
+        }
+
+        bool try_pop(T &value){
+            std::lock_guard<std::mutex> lock(mutex);
+            if(container.empty()){
+                return false;
+            }
+
+            value = std::move(container.front());
+            container.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex mutex;
+        Container container;
+};
+
+// Bounded single producer single consumer ring. Each side keeps a copy of the
+// index of the other one and only reloads it when the ring looks full (or
+// empty), so the shared cache lines are rarely touched.
+template<typename T>
+class spsc_ring {
+    public:
+        using value_type = T;
+
+        static constexpr bool multi_producer = false;
+        static constexpr bool multi_consumer = false;
+
+        explicit spsc_ring(std::size_t capacity) : mask(round_up_pow2(capacity) - 1), buffer(mask + 1) {}
+
+        bool try_push(const T &value){
+            auto t = tail.load(std::memory_order_relaxed);
+            if(t - head_cache > mask){
+                head_cache = head.load(std::memory_order_acquire);
+                if(t - head_cache > mask){
+                    return false;
+                }
+            }
+
+            buffer[t & mask] = value;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(T &value){
+            auto h = head.load(std::memory_order_relaxed);
+            if(h == tail_cache){
+                tail_cache = tail.load(std::memory_order_acquire);
+                if(h == tail_cache){
+                    return false;
+                }
+            }
+
+            value = std::move(buffer[h & mask]);
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        const std::size_t mask;
+        std::vector<T> buffer;
+
+        // consumer side
+        alignas(cache_line) std::atomic<std::size_t> head{0};
+        std::size_t tail_cache = 0;
+
+        // producer side
+        alignas(cache_line) std::atomic<std::size_t> tail{0};
+        std::size_t head_cache = 0;
+};
+
+// Bounded multiple producers multiple consumers ring (Dmitry Vyukov). Each
+// cell carries a sequence number telling whether it is ready to be written or
+// read for the current lap, so producers and consumers only contend on their
+// own index.
+template<typename T>
+class mpmc_ring {
+    public:
+        using value_type = T;
+
+        static constexpr bool multi_producer = true;
+        static constexpr bool multi_consumer = true;
+
+        explicit mpmc_ring(std::size_t capacity) : mask(round_up_pow2(capacity) - 1), cells(new cell[mask + 1]) {
+            for(std::size_t i = 0; i <= mask; ++i){
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool try_push(const T &value){
+            cell *c;
+            auto position = enqueue.load(std::memory_order_relaxed);
+            while(true){
+                c = &cells[position & mask];
+                auto sequence = c->sequence.load(std::memory_order_acquire);
+                auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                if(difference == 0){
+                    if(enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){
+                        break;
+                    }
+                } else if(difference < 0){
+                    return false;
+                } else {
+                    position = enqueue.load(std::memory_order_relaxed);
+                }
+            }
+
+            c->data = value;
+            c->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(T &value){
+            cell *c;
+            auto position = dequeue.load(std::memory_order_relaxed);
+            while(true){
+                c = &cells[position & mask];
+                auto sequence = c->sequence.load(std::memory_order_acquire);
+                auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+                if(difference == 0){
+                    if(dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){
+                        break;
+                    }
+                } else if(difference < 0){
+                    return false;
+                } else {
+                    position = dequeue.load(std::memory_order_relaxed);
+                }
+            }
+
+            value = std::move(c->data);
+            c->sequence.store(position + mask + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        struct cell {
+            std::atomic<std::size_t> sequence;
+            T data;
+        };
+
+        const std::size_t mask;
+        std::unique_ptr<cell[]> cells;
+
+        alignas(cache_line) std::atomic<std::size_t> enqueue{0};
+        alignas(cache_line) std::atomic<std::size_t> dequeue{0};
+};
+
+// Unbounded multiple producers single consumer linked queue (Dmitry Vyukov).
+// Producers only exchange the head, the consumer follows the links from a
+// stub node and is the only one to free the nodes.
+template<typename T>
+class mpsc_queue {
+    public:
+        using value_type = T;
+
+        static constexpr bool multi_producer = true;
+        static constexpr bool multi_consumer = false;
+
+        explicit mpsc_queue(std::size_t) : head(new node), tail(head.load(std::memory_order_relaxed)) {}
+
+        mpsc_queue(const mpsc_queue &) = delete;
+        mpsc_queue &operator=(const mpsc_queue &) = delete;
+
+        ~mpsc_queue(){
+            while(tail){
+                auto next = tail->next.load(std::memory_order_relaxed);
+                delete tail;
+                tail = next;
+            }
+        }
+
+        bool try_push(const T &value){
+            auto n = new node;
+            n->value = value;
+
+            // the queue looks empty to the consumer until the link is made
+            auto previous = head.exchange(n, std::memory_order_acq_rel);
+            previous->next.store(n, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(T &value){
+            auto next = tail->next.load(std::memory_order_acquire);
+            if(!next){
+                return false;
+            }
+
+            value = std::move(next->value);
+            delete tail;
+            tail = next;
+            return true;
+        }
+
+    private:
+        struct node {
+            std::atomic<node *> next{nullptr};
+            T value;
+        };
+
+        alignas(cache_line) std::atomic<node *> head;
+        alignas(cache_line) node *tail;
+};
+
+} //end of namespace queues
+
+#endif
@@ -0,0 +1,191 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_RADIX_SORT
+#define ARTICLES_RADIX_SORT
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace radix {
+
+// All the tested types are keyed by their integer member
+template<typename T>
+inline std::size_t key(const T &value){
+    return value.a;
+}
+
+template<unsigned Bits>
+inline std::size_t digit(std::size_t key, unsigned shift){
+    return (key >> shift) & ((std::size_t(1) << Bits) - 1);
+}
+
+// LSD radix sort with Bits wide digits.
+//
+// A single pass over the input computes the histograms of all the digits,
+// then each digit is scattered between the container and a temporary buffer
+// (ping-pong). Digits that have the same value for all the keys (i.e. the high
+// digits of small keys) are already sorted and are skipped.
+template<unsigned Bits, typename RandomIt>
+void lsd_sort(RandomIt first, RandomIt last){
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+
+    constexpr unsigned key_bits = std::numeric_limits<std::size_t>::digits;
+    constexpr unsigned passes = (key_bits + Bits - 1) / Bits;
+    constexpr std::size_t buckets = std::size_t(1) << Bits;
+
+    const std::size_t n = std::distance(first, last);
+    if(n < 2){
+        return;
+    }
+
+    std::vector<std::size_t> counts(passes * buckets);
+    for(auto it = first; it != last; ++it){
+        auto k = key(*it);
+        for(unsigned p = 0; p < passes; ++p){
+            ++counts[p * buckets + digit<Bits>(k, p * Bits)];
+        }
+    }
+
+    std::allocator<T> allocator;
+    T *buffer = allocator.allocate(n);
+    bool constructed = false;
+    bool in_buffer = false;
+
+    const auto first_key = key(*first);
+    std::vector<std::size_t> offsets(buckets);
+
+    for(unsigned p = 0; p < passes; ++p){
+        const unsigned shift = p * Bits;
+        const std::size_t *count = &counts[p * buckets];
+
+        if(count[digit<Bits>(first_key, shift)] == n){
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for(std::size_t b = 0; b < buckets; ++b){
+            offsets[b] = offset;
+            offset += count[b];
+        }
+
+        if(!in_buffer){
+            // the first scatter constructs every slot of the buffer exactly once
+            for(auto it = first; it != last; ++it){
+                T *dest = buffer + offsets[digit<Bits>(key(*it), shift)]++;
+                if(constructed){
+                    *dest = std::move(*it);
+                } else {
+                    new (dest) T(std::move(*it));
+                }
+            }
+            constructed = true;
+        } else {
+            for(std::size_t i = 0; i < n; ++i){
+                first[offsets[digit<Bits>(key(buffer[i]), shift)]++] = std::move(buffer[i]);
+            }
+        }
+
+        in_buffer = !in_buffer;
+    }
+
+    if(in_buffer){
+        std::move(buffer, buffer + n, first);
+    }
+
+    if(constructed){
+        std::destroy(buffer, buffer + n);
+    }
+
+    allocator.deallocate(buffer, n);
+}
+
+template<typename RandomIt>
+void american_flag_sort(RandomIt first, RandomIt last, unsigned shift){
+    constexpr unsigned Bits = 8;
+    constexpr std::size_t buckets = std::size_t(1) << Bits;
+
+    const std::size_t n = std::distance(first, last);
+    if(n < 64){
+        std::sort(first, last);
+        return;
+    }
+
+    std::size_t counts[buckets] = {};
+    for(auto it = first; it != last; ++it){
+        ++counts[digit<Bits>(key(*it), shift)];
+    }
+
+    std::size_t heads[buckets];
+    std::size_t ends[buckets];
+    std::size_t offset = 0;
+    for(std::size_t b = 0; b < buckets; ++b){
+        heads[b] = offset;
+        offset += counts[b];
+        ends[b] = offset;
+    }
+
+    // permute in place: every element is swapped straight into its bucket
+    if(counts[digit<Bits>(key(*first), shift)] != n){
+        for(std::size_t b = 0; b < buckets; ++b){
+            while(heads[b] < ends[b]){
+                auto d = digit<Bits>(key(first[heads[b]]), shift);
+                if(d == b){
+                    ++heads[b];
+                } else {
+                    using std::swap;
+                    swap(first[heads[b]], first[heads[d]++]);
+                }
+            }
+        }
+    }
+
+    if(shift == 0){
+        return;
+    }
+
+    std::size_t begin = 0;
+    for(std::size_t b = 0; b < buckets; ++b){
+        if(ends[b] - begin > 1){
+            american_flag_sort(first + begin, first + ends[b], shift - Bits);
+        }
+        begin = ends[b];
+    }
+}
+
+// In-place MSD radix sort (American flag sort) with 8 bits digits.
+//
+// No buffer is needed, so large elements are only swapped around instead of
+// being moved twice per digit; the sort starts from the highest digit that is
+// not zero for all the keys.
+template<typename RandomIt>
+void american_flag_sort(RandomIt first, RandomIt last){
+    if(first == last){
+        return;
+    }
+
+    std::size_t max = 0;
+    for(auto it = first; it != last; ++it){
+        max = std::max(max, key(*it));
+    }
+
+    unsigned shift = 0;
+    while(shift + 8 < std::numeric_limits<std::size_t>::digits && (max >> (shift + 8))){
+        shift += 8;
+    }
+
+    american_flag_sort(first, last, shift);
+}
+
+} //end of namespace radix
+
+#endif
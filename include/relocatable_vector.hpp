@@ -0,0 +1,203 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_RELOCATABLE_VECTOR
+#define ARTICLES_RELOCATABLE_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace relocation {
+
+// A type is trivially relocatable when moving an object to another address
+// and forgetting the old one is the same as copying its bytes: no
+// constructor nor destructor has to run. This is true of the trivially
+// copyable types, the others have to opt in by specializing the trait.
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Vector growing by a factor of two, which relocates the elements with
+// memcpy() and shifts them with memmove() on insertion and erasure when they
+// are trivially relocatable, and moves them as std::vector otherwise
+template<typename T>
+class relocatable_vector {
+    static constexpr bool trivial = is_trivially_relocatable<T>::value;
+
+    public:
+        using value_type = T;
+        using iterator = T *;
+        using const_iterator = const T *;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = std::size_t;
+
+        relocatable_vector() = default;
+
+        relocatable_vector(const relocatable_vector &) = delete;
+        relocatable_vector &operator=(const relocatable_vector &) = delete;
+
+        relocatable_vector(relocatable_vector &&other) noexcept : data(other.data), count(other.count), allocated(other.allocated) {
+            other.data = nullptr;
+            other.count = 0;
+            other.allocated = 0;
+        }
+
+        relocatable_vector &operator=(relocatable_vector &&other) noexcept {
+            std::swap(data, other.data);
+            std::swap(count, other.count);
+            std::swap(allocated, other.allocated);
+            return *this;
+        }
+
+        ~relocatable_vector(){
+            clear();
+            std::allocator<T>().deallocate(data, allocated);
+        }
+
+        std::size_t size() const { return count; }
+        std::size_t capacity() const { return allocated; }
+        bool empty() const { return !count; }
+
+        iterator begin(){ return data; }
+        iterator end(){ return data + count; }
+        const_iterator begin() const { return data; }
+        const_iterator end() const { return data + count; }
+
+        friend iterator begin(relocatable_vector &v){ return v.begin(); }
+        friend iterator end(relocatable_vector &v){ return v.end(); }
+        friend const_iterator begin(const relocatable_vector &v){ return v.begin(); }
+        friend const_iterator end(const relocatable_vector &v){ return v.end(); }
+
+        T &operator[](std::size_t i){ return data[i]; }
+        const T &operator[](std::size_t i) const { return data[i]; }
+
+        T &front(){ return data[0]; }
+        T &back(){ return data[count - 1]; }
+
+        void reserve(std::size_t n){
+            if(n > allocated){
+                reallocate(n);
+            }
+        }
+
+        void push_back(const T &value){
+            emplace_back(value);
+        }
+
+        void push_back(T &&value){
+            emplace_back(std::move(value));
+        }
+
+        template<typename... Args>
+        T &emplace_back(Args&&... args){
+            if(count == allocated){
+                // the arguments may refer to the current elements
+                T value(std::forward<Args>(args)...);
+                grow();
+                new (data + count) T(std::move(value));
+            } else {
+                new (data + count) T(std::forward<Args>(args)...);
+            }
+
+            return data[count++];
+        }
+
+        iterator insert(const_iterator position, const T &value){
+            return emplace(position, value);
+        }
+
+        iterator insert(const_iterator position, T &&value){
+            return emplace(position, std::move(value));
+        }
+
+        template<typename... Args>
+        iterator emplace(const_iterator position, Args&&... args){
+            std::size_t i = position - data;
+
+            // the arguments may refer to the shifted elements
+            T value(std::forward<Args>(args)...);
+
+            if(count == allocated){
+                grow();
+            }
+
+            if constexpr (trivial) {
+                std::memmove(static_cast<void *>(data + i + 1), static_cast<const void *>(data + i), (count - i) * sizeof(T));
+                new (data + i) T(std::move(value));
+            } else if(i == count){
+                new (data + i) T(std::move(value));
+            } else {
+                new (data + count) T(std::move(data[count - 1]));
+                std::move_backward(data + i, data + count - 1, data + count);
+                data[i] = std::move(value);
+            }
+
+            ++count;
+            return data + i;
+        }
+
+        iterator erase(const_iterator position){
+            std::size_t i = position - data;
+
+            if constexpr (trivial) {
+                data[i].~T();
+                std::memmove(static_cast<void *>(data + i), static_cast<const void *>(data + i + 1), (count - i - 1) * sizeof(T));
+            } else {
+                std::move(data + i + 1, data + count, data + i);
+                data[count - 1].~T();
+            }
+
+            --count;
+            return data + i;
+        }
+
+        void pop_back(){
+            data[--count].~T();
+        }
+
+        void clear(){
+            std::destroy(data, data + count);
+            count = 0;
+        }
+
+    private:
+        void grow(){
+            reallocate(std::max<std::size_t>(1, 2 * allocated));
+        }
+
+        void reallocate(std::size_t n){
+            auto storage = std::allocator<T>().allocate(n);
+
+            if constexpr (trivial) {
+                if(count){
+                    std::memcpy(static_cast<void *>(storage), static_cast<const void *>(data), count * sizeof(T));
+                }
+            } else {
+                for(std::size_t i = 0; i < count; ++i){
+                    new (storage + i) T(std::move_if_noexcept(data[i]));
+                }
+                std::destroy(data, data + count);
+            }
+
+            std::allocator<T>().deallocate(data, allocated);
+            data = storage;
+            allocated = n;
+        }
+
+        T *data = nullptr;
+        std::size_t count = 0;
+        std::size_t allocated = 0;
+};
+
+} //end of namespace relocation
+
+#endif
@@ -0,0 +1,235 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_SEARCH
+#define ARTICLES_SEARCH
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Search kernels on sorted data, all of them look for the first element whose
+// key is not less than the searched one and return nullptr if there is none
+
+namespace search {
+
+constexpr std::size_t cache_line = 64;
+
+template<typename T>
+struct cache_aligned_allocator {
+    using value_type = T;
+
+    cache_aligned_allocator() = default;
+    template<typename U>
+    cache_aligned_allocator(const cache_aligned_allocator<U> &) {}
+
+    T *allocate(std::size_t n){
+        std::size_t bytes = (n * sizeof(T) + cache_line - 1) / cache_line * cache_line;
+        if(void *p = std::aligned_alloc(cache_line, bytes))
+            return static_cast<T *>(p);
+        throw std::bad_alloc();
+    }
+
+    void deallocate(T *p, std::size_t){
+        std::free(p);
+    }
+
+    template<typename U>
+    bool operator==(const cache_aligned_allocator<U> &) const { return true; }
+    template<typename U>
+    bool operator!=(const cache_aligned_allocator<U> &) const { return false; }
+};
+
+template<typename T>
+inline void prefetch(const T *base, std::size_t index){
+    // the address may be past the end, which is fine for a prefetch
+    __builtin_prefetch(reinterpret_cast<const void *>(reinterpret_cast<std::uintptr_t>(base) + index * sizeof(T)));
+}
+
+template<typename T>
+const T *lower_bound(const std::vector<T> &c, std::size_t key){
+    auto it = std::lower_bound(c.begin(), c.end(), key, [](const T &v, std::size_t key){ return v.a < key; });
+    return it == c.end() ? nullptr : &*it;
+}
+
+template<class Container>
+const typename Container::value_type *lower_bound(const Container &c, std::size_t key){
+    return c.lower_bound(key);
+}
+
+// Binary search where the comparison only selects the next base, so that it
+// compiles to a conditional move instead of a hardly predictable branch
+template<typename T>
+class branchless_array {
+    public:
+        using value_type = T;
+
+        branchless_array(const std::vector<T> &sorted) : data(sorted) {}
+
+        const T *lower_bound(std::size_t key) const {
+            if(data.empty()){
+                return nullptr;
+            }
+
+            const T *base = data.data();
+            std::size_t n = data.size();
+
+            while(n > 1){
+                std::size_t half = n / 2;
+                base += (base[half - 1].a < key) * half;
+                n -= half;
+            }
+
+            base += base->a < key;
+            return base == data.data() + data.size() ? nullptr : base;
+        }
+
+    private:
+        std::vector<T> data;
+};
+
+// Sorted data stored in breadth first order (1-indexed): the children of i are
+// 2i and 2i+1, so the descendants of the next levels are contiguous and can be
+// prefetched while the current level is compared
+template<typename T>
+class eytzinger_array {
+    public:
+        using value_type = T;
+
+        eytzinger_array(const std::vector<T> &sorted) : data(sorted.size() + 1) {
+            std::size_t i = 0;
+            build(sorted, i, 1);
+        }
+
+        const T *lower_bound(std::size_t key) const {
+            const std::size_t n = data.size() - 1;
+            const T *base = data.data();
+            std::size_t k = 1;
+
+            while(k <= n){
+                if constexpr (sizeof(T) <= cache_line / 2) {
+                    prefetch(base, k * (cache_line / sizeof(T)));
+                } else {
+                    for(std::size_t i = 0; i < 4; ++i)
+                        prefetch(base, k * 4 + i);
+                }
+
+                k = 2 * k + (base[k].a < key);
+            }
+
+            // go back up to the last node where the search went to the left
+            k >>= __builtin_ffsll(~k);
+            return k ? &data[k] : nullptr;
+        }
+
+    private:
+        void build(const std::vector<T> &sorted, std::size_t &i, std::size_t k){
+            if(k < data.size()){
+                build(sorted, i, 2 * k);
+                data[k] = sorted[i++];
+                build(sorted, i, 2 * k + 1);
+            }
+        }
+
+        std::vector<T, cache_aligned_allocator<T>> data;
+};
+
+// Static B-tree laid out in an array (S-tree): nodes hold B keys in a cache
+// line and the children of node k are k * (B + 1) + i + 1. The keys of a node
+// are compared all at once (with AVX2 when available), the elements are kept
+// in a separate array with the same layout.
+template<typename T>
+class s_tree {
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t B = cache_line / sizeof(std::int64_t);
+
+        s_tree(const std::vector<T> &sorted) :
+            blocks((sorted.size() + B - 1) / B), nodes(blocks), items(blocks * B) {
+            std::size_t t = 0;
+            build(sorted, t, 0);
+        }
+
+        const T *lower_bound(std::size_t key) const {
+            const T *result = nullptr;
+            const auto x = static_cast<std::int64_t>(key);
+
+            std::size_t k = 0;
+            while(k < blocks){
+                auto r = rank(nodes[k], x);
+                if(r < B && nodes[k].keys[r] != padding){
+                    result = &items[k * B + r];
+                }
+                k = child(k, r);
+            }
+
+            return result;
+        }
+
+    private:
+        // keys are compared as signed integers, so they must be lower than this
+        static constexpr std::int64_t padding = std::numeric_limits<std::int64_t>::max();
+
+        struct alignas(cache_line) node {
+            std::int64_t keys[B];
+        };
+
+        static std::size_t child(std::size_t k, std::size_t i){
+            return k * (B + 1) + i + 1;
+        }
+
+        // number of keys of the node lower than x
+        static std::size_t rank(const node &n, std::int64_t x){
+#ifdef __AVX2__
+            static_assert(B == 8, "AVX2 rank compares two vectors of 4 keys");
+            __m256i v = _mm256_set1_epi64x(x);
+            __m256i lo = _mm256_cmpgt_epi64(v, _mm256_load_si256(reinterpret_cast<const __m256i *>(n.keys)));
+            __m256i hi = _mm256_cmpgt_epi64(v, _mm256_load_si256(reinterpret_cast<const __m256i *>(n.keys + 4)));
+            unsigned mask = _mm256_movemask_pd(_mm256_castsi256_pd(lo)) | (_mm256_movemask_pd(_mm256_castsi256_pd(hi)) << 4);
+            return __builtin_popcount(mask);
+#else
+            std::size_t r = 0;
+            for(std::size_t i = 0; i < B; ++i)
+                r += n.keys[i] < x;
+            return r;
+#endif
+        }
+
+        void build(const std::vector<T> &sorted, std::size_t &t, std::size_t k){
+            if(k < blocks){
+                for(std::size_t i = 0; i < B; ++i){
+                    build(sorted, t, child(k, i));
+
+                    if(t < sorted.size()){
+                        nodes[k].keys[i] = static_cast<std::int64_t>(sorted[t].a);
+                        items[k * B + i] = sorted[t++];
+                    } else {
+                        nodes[k].keys[i] = padding;
+                    }
+                }
+
+                build(sorted, t, child(k, B));
+            }
+        }
+
+        std::size_t blocks;
+        std::vector<node, cache_aligned_allocator<node>> nodes;
+        std::vector<T> items;
+};
+
+} //end of namespace search
+
+#endif
@@ -0,0 +1,115 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_SEGMENTED_VECTOR
+#define ARTICLES_SEGMENTED_VECTOR
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Vector storing its elements in fixed size segments, which never move once
+// allocated. Unlike std::deque, the segments hold a power of two elements
+// and the first one always starts at index zero, so that indexing is a shift
+// and a mask.
+
+namespace segmented {
+
+constexpr std::size_t log2_floor(std::size_t n){
+    return n <= 1 ? 0 : 1 + log2_floor(n / 2);
+}
+
+template<typename T, std::size_t SegmentBytes = 4096>
+class segmented_vector {
+    static constexpr std::size_t shift = log2_floor(SegmentBytes / sizeof(T));
+    static constexpr std::size_t mask = (std::size_t(1) << shift) - 1;
+
+    public:
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = std::size_t;
+
+        // elements in a segment
+        static constexpr std::size_t segment_size = std::size_t(1) << shift;
+
+        segmented_vector() = default;
+
+        segmented_vector(const segmented_vector &) = delete;
+        segmented_vector &operator=(const segmented_vector &) = delete;
+
+        segmented_vector(segmented_vector &&other) noexcept : segments(std::move(other.segments)), count(other.count) {
+            other.count = 0;
+        }
+
+        segmented_vector &operator=(segmented_vector &&other) noexcept {
+            std::swap(segments, other.segments);
+            std::swap(count, other.count);
+            return *this;
+        }
+
+        ~segmented_vector(){
+            clear();
+        }
+
+        std::size_t size() const { return count; }
+        bool empty() const { return !count; }
+
+        T &operator[](std::size_t i){ return segments[i >> shift].get()[i & mask]; }
+        const T &operator[](std::size_t i) const { return segments[i >> shift].get()[i & mask]; }
+
+        T &front(){ return (*this)[0]; }
+        T &back(){ return (*this)[count - 1]; }
+
+        void push_back(const T &value){
+            emplace_back(value);
+        }
+
+        void push_back(T &&value){
+            emplace_back(std::move(value));
+        }
+
+        template<typename... Args>
+        T &emplace_back(Args&&... args){
+            if(count == segments.size() * segment_size){
+                std::unique_ptr<T, deallocate> segment(std::allocator<T>().allocate(segment_size));
+                segments.push_back(std::move(segment));
+            }
+
+            auto slot = segments[count >> shift].get() + (count & mask);
+            new (slot) T(std::forward<Args>(args)...);
+            ++count;
+            return *slot;
+        }
+
+        void pop_back(){
+            (*this)[--count].~T();
+        }
+
+        void clear(){
+            for(std::size_t i = 0; i < count; ++i){
+                (*this)[i].~T();
+            }
+
+            count = 0;
+            segments.clear();
+        }
+
+    private:
+        struct deallocate {
+            void operator()(T *segment) const { std::allocator<T>().deallocate(segment, segment_size); }
+        };
+
+        std::vector<std::unique_ptr<T, deallocate>> segments;
+        std::size_t count = 0;
+};
+
+} //end of namespace segmented
+
+#endif
@@ -0,0 +1,123 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_THREAD_POOL
+#define ARTICLES_THREAD_POOL
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace parallel {
+
+// Work-stealing thread pool, shared by all the parallel policies.
+//
+// Each thread owns a queue: tasks are pushed to the queue of the thread that
+// spawns them and popped back LIFO, idle threads steal from the front of the
+// others' queues. The thread calling into the pool counts as one of its
+// threads, so a pool of size 1 has no workers at all.
+class thread_pool {
+    public:
+        static thread_pool &instance();
+
+        ~thread_pool();
+
+        void resize(std::size_t threads);
+        std::size_t size() const { return queues.size(); }
+
+        void submit(std::function<void()> task);
+
+        // Run one pending task from the own queue or stolen from another one,
+        // this is how a thread waiting for a join keeps being useful
+        bool run_one();
+
+    private:
+        struct queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        thread_pool();
+
+        void stop();
+        void worker(std::size_t index);
+        bool pop(std::size_t index, std::function<void()> &task);
+
+        std::vector<std::unique_ptr<queue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<std::size_t> pending{0};
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+};
+
+// Fork-join helper: tasks run on the pool and wait() helps running them
+class task_group {
+    public:
+        task_group() = default;
+        task_group(const task_group &) = delete;
+        task_group &operator=(const task_group &) = delete;
+
+        ~task_group(){
+            wait();
+        }
+
+        template<typename Function>
+        void run(Function &&function){
+            if(pool.size() == 1){
+                function();
+                return;
+            }
+
+            active.fetch_add(1, std::memory_order_relaxed);
+            pool.submit([this, function = std::forward<Function>(function)]() mutable {
+                function();
+                active.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        void wait(){
+            while(active.load(std::memory_order_acquire)){
+                if(!pool.run_one()){
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        thread_pool &pool = thread_pool::instance();
+        std::atomic<std::size_t> active{0};
+};
+
+// Split [0, n) in chunks and call function(begin, end) on each of them
+template<typename Function>
+void parallel_for(std::size_t n, std::size_t chunks, Function &&function){
+    if(chunks <= 1 || n < 2){
+        function(std::size_t(0), n);
+        return;
+    }
+
+    task_group group;
+    for(std::size_t i = 1; i < chunks; ++i){
+        std::size_t begin = n * i / chunks;
+        std::size_t end = n * (i + 1) / chunks;
+        group.run([&function, begin, end]{ function(begin, end); });
+    }
+
+    function(std::size_t(0), n / chunks);
+    group.wait();
+}
+
+} //end of namespace parallel
+
+#endif
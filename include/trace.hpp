@@ -0,0 +1,122 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef ARTICLES_TRACE
+#define ARTICLES_TRACE
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Operation traces replayed against the containers.
+//
+// The binary format is a header followed by fixed size records, so that a
+// file can be mapped and replayed without parsing. Positions are stored as a
+// fraction of the size of the container (in 1/2^32), so a trace can be
+// replayed on a container of any size.
+//
+// The text format has one operation per line, positions being in [0, 1]:
+//
+//     initial 10000
+//     push_back <key>
+//     push_front <key>
+//     insert <position> <key>
+//     erase <position>
+//     find <key>
+//     iterate
+//
+// Empty lines and lines starting with # are ignored.
+
+namespace trace {
+
+enum class op : std::uint8_t {
+    PUSH_BACK,
+    PUSH_FRONT,
+    INSERT,
+    ERASE,
+    FIND,
+    ITERATE
+};
+
+constexpr std::size_t operations = 6;
+
+struct header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t initial;      // elements in the container before the replay
+    std::uint64_t count;        // records following the header
+};
+
+struct record {
+    op operation;
+    std::uint8_t reserved[3];
+    std::uint32_t position;
+    std::uint64_t key;
+};
+
+static_assert(sizeof(header) == 24, "The header is part of the file format");
+static_assert(sizeof(record) == 16, "The records are part of the file format");
+
+// Percentage of each operation, in the order of op
+struct mix {
+    std::size_t weights[operations] = {30, 10, 10, 10, 30, 10};
+};
+
+// Parse a mix such as "push_back=40,find=40,erase=20", operations not listed
+// are not generated
+mix parse_mix(const char *spec);
+
+// Index in the container of a position of the trace
+inline std::size_t index(std::uint32_t position, std::size_t size){
+    return static_cast<std::size_t>((static_cast<std::uint64_t>(position) * size) >> 32);
+}
+
+// Trace mapped from a binary file or generated in memory
+class workload {
+    public:
+        workload() = default;
+        workload(const workload &) = delete;
+        workload &operator=(const workload &) = delete;
+        ~workload();
+
+        bool map(const std::string &path);
+        bool save(const std::string &path) const;
+        bool convert(const std::string &text_path);
+        void generate(const mix &m, std::size_t initial, std::size_t count, unsigned seed = 0);
+
+        const record *begin() const { return records; }
+        const record *end() const { return records + count; }
+        std::size_t size() const { return count; }
+        std::size_t initial() const { return initial_size; }
+
+    private:
+        void unmap();
+        void own();
+
+        std::vector<record> owned;
+        void *mapping = nullptr;
+        std::size_t mapping_bytes = 0;
+
+        const record *records = nullptr;
+        std::size_t count = 0;
+        std::size_t initial_size = 0;
+};
+
+// Use the trace of path, or a synthetic one with the given mix when path is
+// not set. Returns false if the trace can't be read.
+bool configure(const char *path, const char *mix_spec, std::size_t synthetic_operations);
+
+// The replayed trace, the synthetic one is generated again for each initial
+// size of the container
+const workload &current();
+void prepare(std::size_t initial);
+bool from_file();
+
+} //end of namespace trace
+
+#endif
@@ -12,6 +12,7 @@
 #include <forward_list>
 #include <algorithm>
 #include <deque>
+#include <queue>
 #include <thread>
 #include <iostream>
 #include <cstdint>
@@ -23,6 +24,9 @@
 
 #include "bench.hpp"
 #include "policies.hpp"
+#include "queues.hpp"
+#include "relocatable_vector.hpp"
+#include "segmented_vector.hpp"
 
 namespace {
 
@@ -157,6 +161,14 @@ static_assert(is_non_trivial_non_nothrow_movable<NonTrivialStringMovable>(), "In
 using NonTrivialArrayMedium = NonTrivialArray<32>;
 static_assert(is_non_trivial_of_size<NonTrivialArrayMedium>(32), "Invalid type");
 
+// Their strings never fit in the small string buffer, which points inside the
+// object itself, and are never left moved-from in a vector, so their bytes
+// can be copied to another address
+namespace relocation {
+template<> struct is_trivially_relocatable<NonTrivialStringMovable> : std::true_type {};
+template<> struct is_trivially_relocatable<NonTrivialStringMovableNoExcept> : std::true_type {};
+} //end of namespace relocation
+
 // Define all benchmarks
 
 template<typename T>
@@ -186,6 +198,7 @@ struct bench_fill_back {
         bench<std::deque<T>,  microseconds, Empty, FillBack>("deque",  sizes);
 
         bench<std::vector<T>, microseconds, Empty, ReserveSize, FillBack>("vector reserve", sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, Empty, FillBack>("relocatable vector", sizes);
     }
 };
 
@@ -203,6 +216,52 @@ struct bench_emplace_back {
     }
 };
 
+template<typename T>
+struct bench_bulk_fill {
+    static const std::string name() { return "bulk_fill"; }
+    static void run(){
+        auto sizes = { 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000 };
+
+        new_graph<T>(name() + " vector", "us");
+        loops<std::vector<T>>(sizes);
+        ranges<std::vector<T>>(sizes);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            bench<std::vector<T>, microseconds, EmptyPrepareBackup, ResizeMemcpy>("resize + memcpy", sizes);
+        }
+
+        new_graph<T>(name() + " list", "us");
+        loops<std::list<T>>(sizes);
+        ranges<std::list<T>>(sizes);
+        bench<std::list<T>, microseconds, EmptyPrepareList, SpliceList>("splice", sizes);
+
+        new_graph<T>(name() + " forward_list", "us");
+        ranges<std::forward_list<T>>(sizes);
+        bench<std::forward_list<T>, microseconds, EmptyPrepareList, SpliceList>("splice_after", sizes);
+
+        new_graph<T>(name() + " deque", "us");
+        loops<std::deque<T>>(sizes);
+        ranges<std::deque<T>>(sizes);
+    }
+
+    // one element at a time
+    template<typename Container, typename Sizes>
+    static void loops(const Sizes &sizes){
+        bench<Container, microseconds, EmptyPrepareBackup, FillBackBackup>("push_back loop", sizes);
+        bench<Container, microseconds, EmptyPrepareBackup, EmplaceBack>("emplace_back loop", sizes);
+        bench<Container, microseconds, EmptyPrepareBackup, FillBackInserter>("back_inserter fill_n", sizes);
+        bench<Container, microseconds, EmptyPrepareBackup, BackInserterCopy>("back_inserter copy", sizes);
+    }
+
+    // the whole range at once
+    template<typename Container, typename Sizes>
+    static void ranges(const Sizes &sizes){
+        bench<Container, microseconds, EmptyPrepareBackup, InsertRange>("insert range", sizes);
+        bench<Container, microseconds, EmptyPrepareBackup, AssignRange>("assign", sizes);
+        bench<Container, microseconds, EmptyPrepareBackup, RangeConstruct>("range constructor", sizes);
+        bench<Container, microseconds, EmptyPrepareBackup, ResizeCopy>("resize + copy", sizes);
+    }
+};
+
 template<typename T>
 struct bench_fill_front {
     static const std::string name() { return "fill_front"; }
@@ -245,10 +304,34 @@ struct bench_linear_search {
     static void run(){
         new_graph<T>(name(), "us");
         auto sizes = {1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000};
-        bench<std::vector<T>, microseconds, FilledRandom, Find>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, Find>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, Find>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, Find>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomLookups, Find>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomLookups, Find>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomLookups, Find>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomLookups, Find>("deque",  sizes);
+    }
+};
+
+template<typename T>
+struct bench_sorted_search {
+    static const std::string name() { return "sorted_search"; }
+    static void run(){
+        // from fitting the L1 cache to well past the last level cache
+        std::vector<std::size_t> sizes;
+        for(std::size_t bytes = 16 << 10; bytes <= (256 << 20); bytes *= 4){
+            sizes.push_back(std::max<std::size_t>(bytes / sizeof(T), 1));
+        }
+
+        new_graph<T>(name() + " uniform", "us");
+        bench<std::vector<T>,                microseconds, FilledSorted, SearchUniform>("std::lower_bound", sizes);
+        bench<search::branchless_array<T>, microseconds, FilledSorted, SearchUniform>("branchless", sizes);
+        bench<search::eytzinger_array<T>,  microseconds, FilledSorted, SearchUniform>("eytzinger", sizes);
+        bench<search::s_tree<T>,           microseconds, FilledSorted, SearchUniform>("s-tree", sizes);
+
+        new_graph<T>(name() + " skewed", "us");
+        bench<std::vector<T>,                microseconds, FilledSorted, SearchSkewed>("std::lower_bound", sizes);
+        bench<search::branchless_array<T>, microseconds, FilledSorted, SearchSkewed>("branchless", sizes);
+        bench<search::eytzinger_array<T>,  microseconds, FilledSorted, SearchSkewed>("eytzinger", sizes);
+        bench<search::s_tree<T>,           microseconds, FilledSorted, SearchSkewed>("s-tree", sizes);
     }
 };
 
@@ -262,6 +345,22 @@ struct bench_random_insert {
         bench<std::list<T>,   milliseconds, FilledRandom, Insert>("list",   sizes);
         // bench<std::forward_list<T>, milliseconds, FilledRandom, Insert>("forward_list", sizes);
         bench<std::deque<T>,  milliseconds, FilledRandom, Insert>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, milliseconds, FilledRandom, Insert>("relocatable vector", sizes);
+        bench<indirect::pointer_vector<T>, milliseconds, FilledRandom, Insert>("vector unique_ptr", sizes);
+        bench<indirect::pool_vector<T>,    milliseconds, FilledRandom, Insert>("vector pool",       sizes);
+
+        bench<std::vector<T>, milliseconds, FilledRandom, BatchInsert1>("vector batch 1", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, BatchInsert8>("vector batch 8", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, BatchInsert64>("vector batch 64", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, BatchInsert1000>("vector batch 1000", sizes);
+        bench<std::list<T>,   milliseconds, FilledRandom, BatchInsert1>("list batch 1",   sizes);
+        bench<std::list<T>,   milliseconds, FilledRandom, BatchInsert8>("list batch 8",   sizes);
+        bench<std::list<T>,   milliseconds, FilledRandom, BatchInsert64>("list batch 64",   sizes);
+        bench<std::list<T>,   milliseconds, FilledRandom, BatchInsert1000>("list batch 1000",   sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, BatchInsert1>("deque batch 1",  sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, BatchInsert8>("deque batch 8",  sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, BatchInsert64>("deque batch 64",  sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, BatchInsert1000>("deque batch 1000",  sizes);
     }
 };
 
@@ -271,13 +370,15 @@ struct bench_random_remove {
     static void run(){
         new_graph<T>(name(), "us");
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, microseconds, FilledRandom, Erase>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, Erase>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, Erase>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, Erase>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomErasures, Erase>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomErasures, Erase>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomErasures, Erase>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomErasures, Erase>("deque",  sizes);
+        bench<indirect::pointer_vector<T>, microseconds, FilledRandomErasures, Erase>("vector unique_ptr", sizes);
+        bench<indirect::pool_vector<T>,    microseconds, FilledRandomErasures, Erase>("vector pool",       sizes);
 
-        bench<std::vector<T>, microseconds, FilledRandom, EraseShrink>("vector shrink", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, EraseShrink>("deque shrink",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomErasures, EraseShrink>("vector shrink", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomErasures, EraseShrink>("deque shrink",  sizes);
 
         bench<std::vector<T>, microseconds, FilledRandom, RemoveErase>("vector rem", sizes);
         bench<std::list<T>,   microseconds, FilledRandom, RemoveErase>("list rem",   sizes);
@@ -299,6 +400,7 @@ struct bench_erase_front {
         bench<std::list<T>,   microseconds, FilledRandom, EraseFront>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledRandom, EraseFront>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, EraseFront>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, FilledRandom, EraseFront>("relocatable vector", sizes);
 
         bench<std::vector<T>, microseconds, FilledRandom, EraseFrontShrink>("vector shrink", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, EraseFrontShrink>("deque shrink",  sizes);
@@ -330,6 +432,7 @@ struct bench_erase_front_value {
         bench<std::list<T>,   microseconds, FilledSequential, EraseFrontValue>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledSequential, EraseFrontValue>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledSequential, EraseFrontValue>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, FilledSequential, EraseFrontValue>("relocatable vector", sizes);
 
         bench<std::vector<T>, microseconds, FilledSequential, EraseFrontValueShrink>("vector shrink", sizes);
         bench<std::deque<T>,  microseconds, FilledSequential, EraseFrontValueShrink>("deque shrink",  sizes);
@@ -361,6 +464,9 @@ struct bench_erase_middle {
         bench<std::list<T>,   microseconds, FilledRandom, EraseMiddle>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledRandom, EraseMiddle>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, EraseMiddle>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, FilledRandom, EraseMiddle>("relocatable vector", sizes);
+        bench<indirect::pointer_vector<T>, microseconds, FilledRandom, EraseMiddle>("vector unique_ptr", sizes);
+        bench<indirect::pool_vector<T>,    microseconds, FilledRandom, EraseMiddle>("vector pool",       sizes);
 
         bench<std::vector<T>, microseconds, FilledRandom, EraseMiddleShrink>("vector shrink", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, EraseMiddleShrink>("deque shrink",  sizes);
@@ -392,6 +498,7 @@ struct bench_erase_middle_value {
         bench<std::list<T>,   microseconds, FilledSequential, EraseMiddleValue>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledSequential, EraseMiddleValue>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledSequential, EraseMiddleValue>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, FilledSequential, EraseMiddleValue>("relocatable vector", sizes);
 
         bench<std::vector<T>, microseconds, FilledSequential, EraseMiddleValueShrink>("vector shrink", sizes);
         bench<std::deque<T>,  microseconds, FilledSequential, EraseMiddleValueShrink>("deque shrink",  sizes);
@@ -423,6 +530,7 @@ struct bench_erase_back {
         bench<std::list<T>,   microseconds, FilledRandom, EraseBack>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledRandom, EraseBack>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, EraseBack>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, FilledRandom, EraseBack>("relocatable vector", sizes);
 
         bench<std::vector<T>, microseconds, FilledRandom, EraseBackShrink>("vector shrink", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, EraseBackShrink>("deque shrink",  sizes);
@@ -454,6 +562,7 @@ struct bench_erase_back_value {
         bench<std::list<T>,   microseconds, FilledSequential, EraseBackValue>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledSequential, EraseBackValue>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledSequential, EraseBackValue>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, microseconds, FilledSequential, EraseBackValue>("relocatable vector", sizes);
 
         bench<std::vector<T>, microseconds, FilledSequential, EraseBackValueShrink>("vector shrink", sizes);
         bench<std::deque<T>,  microseconds, FilledSequential, EraseBackValueShrink>("deque shrink",  sizes);
@@ -485,6 +594,133 @@ struct bench_sort {
         bench<std::list<T>,   milliseconds, FilledRandom, Sort>("list",   sizes);
         // bench<std::forward_list>,   milliseconds, FilledRandom, Sort>("forward_list", sizes);
         bench<std::deque<T>,  milliseconds, FilledRandom, Sort>("deque",  sizes);
+        bench<indirect::pointer_vector<T>, milliseconds, FilledRandom, Sort>("vector unique_ptr", sizes);
+        bench<indirect::pool_vector<T>,    milliseconds, FilledRandom, Sort>("vector pool",       sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, SortByKey>("vector sort by key", sizes);
+
+        bench<std::vector<T>, milliseconds, FilledRandom, RadixSort8>("vector radix8", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, RadixSort11>("vector radix11", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, RadixSort16>("vector radix16", sizes);
+        bench<std::vector<T>, milliseconds, FilledRandom, AmericanFlagSort>("vector american flag", sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, RadixSort8>("deque radix8",  sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, RadixSort11>("deque radix11",  sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, RadixSort16>("deque radix16",  sizes);
+        bench<std::deque<T>,  milliseconds, FilledRandom, AmericanFlagSort>("deque american flag",  sizes);
+    }
+};
+
+template<typename T>
+struct bench_algorithms {
+    static const std::string name() { return "algorithms"; }
+    static void run(){
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+
+        new_graph<T>(name() + " reverse", "us");
+        all<FilledRandom, Reverse>(sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, ReverseParUnseq>(sizes);
+#endif
+
+        new_graph<T>(name() + " rotate", "us");
+        all<FilledRandom, Rotate>(sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, RotateParUnseq>(sizes);
+#endif
+
+        new_graph<T>(name() + " partition", "us");
+        all<FilledRandom, Partition>(sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, PartitionParUnseq>(sizes);
+#endif
+
+        // it needs bidirectional iterators
+        new_graph<T>(name() + " stable_partition", "us");
+        bench<std::vector<T>, microseconds, FilledRandom, StablePartition>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, StablePartition>("list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, StablePartition>("deque",  sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, StablePartitionParUnseq>(sizes);
+#endif
+
+        new_graph<T>(name() + " unique", "us");
+        all<FilledRuns, Unique>(sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRuns, UniqueParUnseq>(sizes);
+#endif
+
+        // it needs random access iterators
+        new_graph<T>(name() + " nth_element", "us");
+        bench<std::vector<T>, microseconds, FilledRandom, NthElement>("vector", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, NthElement>("deque",  sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, NthElementParUnseq>(sizes);
+#endif
+
+        new_graph<T>(name() + " stable_sort", "us");
+        all<FilledRandom, StableSort>(sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, StableSortParUnseq>(sizes);
+#endif
+
+        new_graph<T>(name() + " accumulate", "us");
+        all<FilledRandom, Accumulate>(sizes);
+        bench<std::vector<T>, microseconds, FilledRandom, TransformReduce>("vector transform_reduce", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, TransformReduce>("deque transform_reduce",  sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledRandom, TransformReduceParUnseq>(sizes);
+#endif
+
+        new_graph<T>(name() + " merge", "us");
+        all<FilledSortedPair, Merge>(sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledSortedPair, MergeParUnseq>(sizes);
+#endif
+
+        // there is no way to erase the end of a forward_list
+        new_graph<T>(name() + " set_intersection", "us");
+        bench<std::vector<T>, microseconds, FilledSortedPair, SetIntersection>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledSortedPair, SetIntersection>("list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledSortedPair, SetIntersection>("deque",  sizes);
+#ifdef BENCH_HAVE_TBB
+        parallel<FilledSortedPair, SetIntersectionParUnseq>(sizes);
+#endif
+    }
+
+    template<template<class> class Create, template<class> class Test, typename Sizes>
+    static void all(const Sizes &sizes){
+        bench<std::vector<T>,       microseconds, Create, Test>("vector",       sizes);
+        bench<std::list<T>,         microseconds, Create, Test>("list",         sizes);
+        bench<std::forward_list<T>, microseconds, Create, Test>("forward_list", sizes);
+        bench<std::deque<T>,        microseconds, Create, Test>("deque",        sizes);
+    }
+
+    template<template<class> class Create, template<class> class Test, typename Sizes>
+    static void parallel(const Sizes &sizes){
+        bench<std::vector<T>, microseconds, Create, Test>("vector par_unseq", sizes);
+        bench<std::deque<T>,  microseconds, Create, Test>("deque par_unseq",  sizes);
+    }
+};
+
+template<typename T>
+struct bench_parallel_sort {
+    static const std::string name() { return "parallel_sort"; }
+    static void run(){
+        new_graph<T>(name(), "us", "Number of threads");
+
+        // multi-million elements, limited to 512MiB for the biggest types
+        const std::size_t size = std::min<std::size_t>(4000000, (512 << 20) / sizeof(T));
+        const auto threads = thread_counts();
+
+        scaling_series series;
+        bench_threads<std::vector<T>, microseconds, FilledRandom, Sort>("vector std::sort", size, threads);
+        series.emplace_back("vector merge", bench_threads<std::vector<T>, microseconds, FilledRandom, ParallelMergeSort>("vector merge", size, threads));
+        series.emplace_back("deque merge",  bench_threads<std::deque<T>,  microseconds, FilledRandom, ParallelMergeSort>("deque merge",  size, threads));
+#ifdef BENCH_HAVE_TBB
+        series.emplace_back("vector std::par", bench_threads<std::vector<T>, microseconds, FilledRandom, ParallelStdSort>("vector std::par", size, threads));
+        series.emplace_back("deque std::par",  bench_threads<std::deque<T>,  microseconds, FilledRandom, ParallelStdSort>("deque std::par",  size, threads));
+#endif
+
+        scaling_graphs<T>(name(), threads, series);
     }
 };
 
@@ -501,16 +737,107 @@ struct bench_destruction {
     }
 };
 
+template<typename T>
+struct bench_growth {
+    static const std::string name() { return "growth"; }
+
+    template<growth::method Method> using x1_5   = growth::growth_vector<T, 3, 2, Method>;
+    template<growth::method Method> using x2     = growth::growth_vector<T, 2, 1, Method>;
+    template<growth::method Method> using golden = growth::growth_vector<T, 1618, 1000, Method>;
+
+    static void run(){
+        auto sizes = { 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000 };
+
+        new_graph<T>(name() + " fill_back", "us");
+        bench<std::vector<T>, microseconds, Empty, FillBack>("vector", sizes);
+        bench<std::vector<T>, microseconds, Empty, ReserveSize, FillBack>("vector reserve", sizes);
+        growths<growth::method::COPY>(" copy", sizes);
+
+        // realloc() and mremap() only work for trivially copyable types
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            growths<growth::method::REALLOC>(" realloc", sizes);
+            growths<growth::method::MREMAP>(" mremap", sizes);
+        }
+
+        new_graph<T>(name() + " peak memory", "KB");
+        statistics(growth_statistic::PEAK_MEMORY, sizes);
+
+        new_graph<T>(name() + " in place growths", "%");
+        statistics(growth_statistic::IN_PLACE, sizes);
+    }
+
+    template<growth::method Method, typename Sizes>
+    static void growths(const std::string &suffix, const Sizes &sizes){
+        bench<x1_5<Method>,   microseconds, Empty, FillBack>("x1.5" + suffix,   sizes);
+        bench<x2<Method>,     microseconds, Empty, FillBack>("x2" + suffix,     sizes);
+        bench<golden<Method>, microseconds, Empty, FillBack>("x1.618" + suffix, sizes);
+    }
+
+    template<typename Sizes>
+    static void statistics(growth_statistic statistic, const Sizes &sizes){
+        statistics<growth::method::COPY>(statistic, " copy", sizes);
+
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            statistics<growth::method::REALLOC>(statistic, " realloc", sizes);
+            statistics<growth::method::MREMAP>(statistic, " mremap", sizes);
+        }
+    }
+
+    template<growth::method Method, typename Sizes>
+    static void statistics(growth_statistic statistic, const std::string &suffix, const Sizes &sizes){
+        bench_growth_statistic<x1_5<Method>,   Empty, FillBack>(statistic, "x1.5" + suffix,   sizes);
+        bench_growth_statistic<x2<Method>,     Empty, FillBack>(statistic, "x2" + suffix,     sizes);
+        bench_growth_statistic<golden<Method>, Empty, FillBack>(statistic, "x1.618" + suffix, sizes);
+    }
+};
+
+template<typename T>
+struct bench_copy_move {
+    static const std::string name() { return "copy_move"; }
+    static void run(){
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+
+        new_graph<T>(name() + " copy construct", "us");
+        all<microseconds, FilledSource, CopyConstruct>(sizes);
+
+        // the target reuses its storage, or not, depending on its size
+        new_graph<T>(name() + " copy assign same size", "us");
+        all<microseconds, FilledTargetSame, CopyAssign>(sizes);
+        new_graph<T>(name() + " copy assign smaller", "us");
+        all<microseconds, FilledTargetSmaller, CopyAssign>(sizes);
+        new_graph<T>(name() + " copy assign larger", "us");
+        all<microseconds, FilledTargetLarger, CopyAssign>(sizes);
+
+        // the storage is taken over, the old one of the target is released
+        new_graph<T>(name() + " move construct", "ns");
+        all<nanoseconds, FilledSource, MoveConstruct>(sizes);
+        new_graph<T>(name() + " move assign", "us");
+        all<microseconds, FilledTargetSame, MoveAssign>(sizes);
+
+        new_graph<T>(name() + " swap", "ns");
+        all<nanoseconds, FilledTargetSame, Swap>(sizes);
+    }
+
+    template<typename Unit, template<class> class Create, template<class> class Test, typename Sizes>
+    static void all(const Sizes &sizes){
+        bench<std::vector<T>, Unit, Create, Test>("vector", sizes);
+        bench<std::list<T>,   Unit, Create, Test>("list",   sizes);
+        bench<std::forward_list<T>, Unit, Create, Test>("forward_list", sizes);
+        bench<std::deque<T>,  Unit, Create, Test>("deque",  sizes);
+    }
+};
+
 template<typename T>
 struct bench_number_crunching {
     static const std::string name() { return "number_crunching"; }
     static void run(){
         new_graph<T>(name(), "ms");
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, milliseconds, Empty, RandomSortedInsert>("vector", sizes);
-        bench<std::list<T>,   milliseconds, Empty, RandomSortedInsert>("list",   sizes);
-        // bench<std::forward_list<T>, milliseconds, Empty, RandomSortedInsert>("forward_list", sizes);
-        bench<std::deque<T>,  milliseconds, Empty, RandomSortedInsert>("deque",  sizes);
+        bench<std::vector<T>, milliseconds, EmptyPrepareRandomKeys, RandomSortedInsert>("vector", sizes);
+        bench<std::list<T>,   milliseconds, EmptyPrepareRandomKeys, RandomSortedInsert>("list",   sizes);
+        // bench<std::forward_list<T>, milliseconds, EmptyPrepareRandomKeys, RandomSortedInsert>("forward_list", sizes);
+        bench<std::deque<T>,  milliseconds, EmptyPrepareRandomKeys, RandomSortedInsert>("deque",  sizes);
+        bench<relocation::relocatable_vector<T>, milliseconds, EmptyPrepareRandomKeys, RandomSortedInsert>("relocatable vector", sizes);
     }
 };
 
@@ -520,13 +847,13 @@ struct bench_erase_1 {
     static void run(){
         new_graph<T>(name(), "us");
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, microseconds, FilledRandom, RandomErase1>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, RandomErase1>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, RandomErase1>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, RandomErase1>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomDrawn1, RandomErase1>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomDrawn1, RandomErase1>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomDrawn1, RandomErase1>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomDrawn1, RandomErase1>("deque",  sizes);
 
-        bench<std::vector<T>, microseconds, FilledRandom, RandomErase1Shrink>("vector shrink", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, RandomErase1Shrink>("deque shrink",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomDrawn1, RandomErase1Shrink>("vector shrink", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomDrawn1, RandomErase1Shrink>("deque shrink",  sizes);
     }
 };
 
@@ -536,13 +863,13 @@ struct bench_erase_10 {
     static void run(){
         new_graph<T>(name(), "us");
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, microseconds, FilledRandom, RandomErase10>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, RandomErase10>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, RandomErase10>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, RandomErase10>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomDrawn10, RandomErase10>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomDrawn10, RandomErase10>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomDrawn10, RandomErase10>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomDrawn10, RandomErase10>("deque",  sizes);
 
-        bench<std::vector<T>, microseconds, FilledRandom, RandomErase10Shrink>("vector shrink", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, RandomErase10Shrink>("deque shrink",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomDrawn10, RandomErase10Shrink>("vector shrink", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomDrawn10, RandomErase10Shrink>("deque shrink",  sizes);
     }
 };
 
@@ -552,10 +879,10 @@ struct bench_erase_25 {
     static void run(){
         new_graph<T>(name(), "us");
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, microseconds, FilledRandom, RandomErase25>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, RandomErase25>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, RandomErase25>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, RandomErase25>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomDrawn25, RandomErase25>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomDrawn25, RandomErase25>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomDrawn25, RandomErase25>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomDrawn25, RandomErase25>("deque",  sizes);
     }
 };
 
@@ -565,10 +892,10 @@ struct bench_erase_50 {
     static void run(){
         new_graph<T>(name(), "us");
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, microseconds, FilledRandom, RandomErase50>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, RandomErase50>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, RandomErase50>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, RandomErase50>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomDrawn50, RandomErase50>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomDrawn50, RandomErase50>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomDrawn50, RandomErase50>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomDrawn50, RandomErase50>("deque",  sizes);
     }
 };
 
@@ -598,6 +925,25 @@ struct bench_traversal {
         bench<std::list<T>,   microseconds, FilledRandom, Iterate>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledRandom, Iterate>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, Iterate>("deque",  sizes);
+        bench<indirect::pointer_vector<T>, microseconds, FilledRandom, Iterate>("vector unique_ptr", sizes);
+        bench<indirect::pool_vector<T>,    microseconds, FilledRandom, Iterate>("vector pool",       sizes);
+
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchIterate0>("list sum",   sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchIterate4>("list sum prefetch 4",   sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchIterate16>("list sum prefetch 16",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchIterate0>("forward_list sum", sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchIterate4>("forward_list sum prefetch 4", sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchIterate16>("forward_list sum prefetch 16", sizes);
+
+        bench<std::list<T>,   microseconds, FilledScattered, PrefetchIterate0>("list sum scattered",   sizes);
+        bench<std::list<T>,   microseconds, FilledCompacted, PrefetchIterate0>("list sum compacted",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledScattered, PrefetchIterate0>("forward_list sum scattered", sizes);
+        bench<std::forward_list<T>, microseconds, FilledCompacted, PrefetchIterate0>("forward_list sum compacted", sizes);
+
+        bench<std::array<std::list<T>, 8>, microseconds, FilledRandomLists, SequentialListsIterate>("8 lists sum", sizes);
+        bench<std::array<std::list<T>, 8>, microseconds, FilledRandomLists, InterleavedListsIterate>("8 lists sum interleaved", sizes);
+        bench<std::array<std::forward_list<T>, 8>, microseconds, FilledRandomLists, SequentialListsIterate>("8 forward_lists sum", sizes);
+        bench<std::array<std::forward_list<T>, 8>, microseconds, FilledRandomLists, InterleavedListsIterate>("8 forward_lists sum interleaved", sizes);
     }
 };
 
@@ -627,6 +973,56 @@ struct bench_write {
         bench<std::list<T>,   microseconds, FilledRandom, Write>("list",   sizes);
         bench<std::forward_list<T>, microseconds, FilledRandom, Write>("forward_list", sizes);
         bench<std::deque<T>,  microseconds, FilledRandom, Write>("deque",  sizes);
+
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchWrite4>("list prefetch 4",   sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchWrite16>("list prefetch 16",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchWrite4>("forward_list prefetch 4", sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchWrite16>("forward_list prefetch 16", sizes);
+
+        bench<std::list<T>,   microseconds, FilledScattered, Write>("list scattered",   sizes);
+        bench<std::list<T>,   microseconds, FilledCompacted, Write>("list compacted",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledScattered, Write>("forward_list scattered", sizes);
+        bench<std::forward_list<T>, microseconds, FilledCompacted, Write>("forward_list compacted", sizes);
+
+        bench<std::array<std::list<T>, 8>, microseconds, FilledRandomLists, SequentialListsWrite>("8 lists", sizes);
+        bench<std::array<std::list<T>, 8>, microseconds, FilledRandomLists, InterleavedListsWrite>("8 lists interleaved", sizes);
+        bench<std::array<std::forward_list<T>, 8>, microseconds, FilledRandomLists, SequentialListsWrite>("8 forward_lists", sizes);
+        bench<std::array<std::forward_list<T>, 8>, microseconds, FilledRandomLists, InterleavedListsWrite>("8 forward_lists interleaved", sizes);
+    }
+};
+
+template<typename T>
+struct bench_access {
+    static const std::string name() { return "access"; }
+    static void run(){
+        auto sizes = {100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000};
+
+        new_graph<T>(name() + " index", "us");
+        all<FilledRandom, IndexIterate>(sizes);
+        bench<std::vector<T>, microseconds, FilledRandom, PrefetchIterate0>("vector iterator", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, PrefetchIterate0>("deque iterator",  sizes);
+
+        new_graph<T>(name() + " stride 2", "us");
+        all<FilledRandom, Stride2>(sizes);
+        new_graph<T>(name() + " stride 8", "us");
+        all<FilledRandom, Stride8>(sizes);
+        new_graph<T>(name() + " stride 64", "us");
+        all<FilledRandom, Stride64>(sizes);
+        new_graph<T>(name() + " stride page", "us");
+        all<FilledRandom, StridePage>(sizes);
+
+        new_graph<T>(name() + " gather", "us");
+        all<FilledRandomIndices, Gather>(sizes);
+        new_graph<T>(name() + " scatter", "us");
+        all<FilledRandomIndices, Scatter>(sizes);
+    }
+
+    template<template<class> class Create, template<class> class Test, typename Sizes>
+    static void all(const Sizes &sizes){
+        bench<std::vector<T>, microseconds, Create, Test>("vector", sizes);
+        bench<std::deque<T>,  microseconds, Create, Test>("deque",  sizes);
+        bench<segmented::segmented_vector<T>,        microseconds, Create, Test>("segmented 4KB",  sizes);
+        bench<segmented::segmented_vector<T, 65536>, microseconds, Create, Test>("segmented 64KB", sizes);
     }
 };
 
@@ -637,10 +1033,379 @@ struct bench_find {
         new_graph<T>(name(), "us");
 
         auto sizes = {10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
-        bench<std::vector<T>, microseconds, FilledRandom, Find>("vector", sizes);
-        bench<std::list<T>,   microseconds, FilledRandom, Find>("list",   sizes);
-        bench<std::forward_list<T>, microseconds, FilledRandom, Find>("forward_list", sizes);
-        bench<std::deque<T>,  microseconds, FilledRandom, Find>("deque",  sizes);
+        bench<std::vector<T>, microseconds, FilledRandomLookups, Find>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandomLookups, Find>("list",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandomLookups, Find>("forward_list", sizes);
+        bench<std::deque<T>,  microseconds, FilledRandomLookups, Find>("deque",  sizes);
+
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchFind4>("list prefetch 4",   sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, PrefetchFind16>("list prefetch 16",   sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchFind4>("forward_list prefetch 4", sizes);
+        bench<std::forward_list<T>, microseconds, FilledRandom, PrefetchFind16>("forward_list prefetch 16", sizes);
+
+        bench<std::array<std::list<T>, 8>, microseconds, FilledRandomLists, SequentialListsFind>("8 lists", sizes);
+        bench<std::array<std::list<T>, 8>, microseconds, FilledRandomLists, InterleavedListsFind>("8 lists interleaved", sizes);
+        bench<std::array<std::forward_list<T>, 8>, microseconds, FilledRandomLists, SequentialListsFind>("8 forward_lists", sizes);
+        bench<std::array<std::forward_list<T>, 8>, microseconds, FilledRandomLists, InterleavedListsFind>("8 forward_lists interleaved", sizes);
+
+        // all the keys are in the lists, a miss means the series did not
+        // measure the same lookups as the others
+        all_hits<SequentialListsFind, std::array<std::list<T>, 8>>();
+        all_hits<InterleavedListsFind, std::array<std::list<T>, 8>>();
+        all_hits<SequentialListsFind, std::array<std::forward_list<T>, 8>>();
+        all_hits<InterleavedListsFind, std::array<std::forward_list<T>, 8>>();
+    }
+
+    template<template<class> class Find, typename Lists>
+    static void all_hits(){
+        if(Find<Lists>::X){
+            std::cerr << "Warning: " << Find<Lists>::X << " lookups missed in " << demangle(typeid(Find<Lists>).name()) << std::endl;
+        }
+    }
+};
+
+template<typename T>
+struct bench_parallel_traversal {
+    static const std::string name() { return "parallel_traversal"; }
+    static void run(){
+        auto sizes = {1000, 3000, 10000, 30000, 100000, 300000, 1000000};
+        const auto threads = thread_counts();
+
+        new_graph<T>(name() + " vector", "us");
+        bench_per_threads<std::vector<T>, microseconds, FilledRandomSplit, ParallelIterate>("vector", sizes, threads);
+        new_graph<T>(name() + " deque", "us");
+        bench_per_threads<std::deque<T>,  microseconds, FilledRandomSplit, ParallelIterate>("deque",  sizes, threads);
+        new_graph<T>(name() + " list", "us");
+        bench_per_threads<std::list<T>,   microseconds, FilledRandomSplit, ParallelIterate>("list",   sizes, threads);
+        new_graph<T>(name() + " forward_list", "us");
+        bench_per_threads<std::forward_list<T>, microseconds, FilledRandomSplit, ParallelIterate>("forward_list", sizes, threads);
+    }
+};
+
+template<typename T>
+struct bench_parallel_write {
+    static const std::string name() { return "parallel_write"; }
+    static void run(){
+        auto sizes = {1000, 3000, 10000, 30000, 100000, 300000, 1000000};
+        const auto threads = thread_counts();
+
+        new_graph<T>(name() + " vector", "us");
+        bench_per_threads<std::vector<T>, microseconds, FilledRandomSplit, ParallelWrite>("vector", sizes, threads);
+        new_graph<T>(name() + " deque", "us");
+        bench_per_threads<std::deque<T>,  microseconds, FilledRandomSplit, ParallelWrite>("deque",  sizes, threads);
+        new_graph<T>(name() + " list", "us");
+        bench_per_threads<std::list<T>,   microseconds, FilledRandomSplit, ParallelWrite>("list",   sizes, threads);
+        new_graph<T>(name() + " forward_list", "us");
+        bench_per_threads<std::forward_list<T>, microseconds, FilledRandomSplit, ParallelWrite>("forward_list", sizes, threads);
+    }
+};
+
+template<typename T>
+struct bench_parallel_find {
+    static const std::string name() { return "parallel_find"; }
+    static void run(){
+        auto sizes = {1000, 2000, 5000, 10000, 20000};
+        const auto threads = thread_counts();
+
+        new_graph<T>(name() + " vector", "us");
+        bench_per_threads<std::vector<T>, microseconds, FilledRandomSplit, ParallelFind>("vector", sizes, threads);
+        new_graph<T>(name() + " deque", "us");
+        bench_per_threads<std::deque<T>,  microseconds, FilledRandomSplit, ParallelFind>("deque",  sizes, threads);
+        new_graph<T>(name() + " list", "us");
+        bench_per_threads<std::list<T>,   microseconds, FilledRandomSplit, ParallelFind>("list",   sizes, threads);
+        new_graph<T>(name() + " forward_list", "us");
+        bench_per_threads<std::forward_list<T>, microseconds, FilledRandomSplit, ParallelFind>("forward_list", sizes, threads);
+    }
+};
+
+template<typename T>
+struct bench_queues {
+    static const std::string name() { return "queues"; }
+    static void run(){
+        // only up to TrivialLarge: the unbounded queues may buffer most of
+        // the items when the consumers fall behind
+        if constexpr (!std::is_trivial<T>::value || sizeof(T) > 128) {
+            return;
+        }
+
+        const std::size_t items = 1 << 20;
+
+        std::vector<std::pair<std::size_t, std::size_t>> spsc{{1, 1}};
+        std::vector<std::pair<std::size_t, std::size_t>> mpsc;
+        std::vector<std::pair<std::size_t, std::size_t>> mpmc;
+        for(auto n : thread_counts()){
+            mpsc.emplace_back(n, 1);
+            mpmc.emplace_back(n, n);
+        }
+
+        queue_series series;
+        series.emplace_back("mutex deque", bench_queue<queues::locked_queue<T>>(spsc, items));
+        series.emplace_back("mutex list",  bench_queue<queues::locked_queue<T, std::list<T>>>(spsc, items));
+        series.emplace_back("spsc ring",   bench_queue<queues::spsc_ring<T>>(spsc, items));
+        series.emplace_back("mpmc ring",   bench_queue<queues::mpmc_ring<T>>(spsc, items));
+        series.emplace_back("mpsc linked", bench_queue<queues::mpsc_queue<T>>(spsc, items));
+        queue_graphs<T>(name() + " spsc", series);
+
+        series.clear();
+        series.emplace_back("mutex deque", bench_queue<queues::locked_queue<T>>(mpsc, items));
+        series.emplace_back("mutex list",  bench_queue<queues::locked_queue<T, std::list<T>>>(mpsc, items));
+        series.emplace_back("mpmc ring",   bench_queue<queues::mpmc_ring<T>>(mpsc, items));
+        series.emplace_back("mpsc linked", bench_queue<queues::mpsc_queue<T>>(mpsc, items));
+        queue_graphs<T>(name() + " mpsc", series);
+
+        series.clear();
+        series.emplace_back("mutex deque", bench_queue<queues::locked_queue<T>>(mpmc, items));
+        series.emplace_back("mutex list",  bench_queue<queues::locked_queue<T, std::list<T>>>(mpmc, items));
+        series.emplace_back("mpmc ring",   bench_queue<queues::mpmc_ring<T>>(mpmc, items));
+        queue_graphs<T>(name() + " mpmc", series);
+    }
+};
+
+template<typename T>
+struct bench_work_stealing {
+    static const std::string name() { return "work_stealing"; }
+    static void run(){
+        const auto threads = thread_counts();
+
+        // one task per element, limited to 256MiB for the biggest types
+        const std::size_t tasks = std::min<std::size_t>(1 << 20, (256 << 20) / sizeof(T));
+
+        new_graph<T>(name() + " 0% left to thieves", "us", "Number of threads");
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealChaseLev0>("chase-lev", tasks, threads);
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealLocked0>("locked deque", tasks, threads);
+        new_graph<T>(name() + " 10% left to thieves", "us", "Number of threads");
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealChaseLev10>("chase-lev", tasks, threads);
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealLocked10>("locked deque", tasks, threads);
+        new_graph<T>(name() + " 50% left to thieves", "us", "Number of threads");
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealChaseLev50>("chase-lev", tasks, threads);
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealLocked50>("locked deque", tasks, threads);
+        new_graph<T>(name() + " 90% left to thieves", "us", "Number of threads");
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealChaseLev90>("chase-lev", tasks, threads);
+        bench_threads<std::vector<T>, microseconds, FilledRandom, StealLocked90>("locked deque", tasks, threads);
+
+        // multi-million elements, limited to 512MiB for the biggest types
+        const std::size_t size = std::min<std::size_t>(4000000, (512 << 20) / sizeof(T));
+
+        new_graph<T>(name() + " fork-join sum", "us", "Number of threads");
+        scaling_series series;
+        series.emplace_back("chase-lev",    bench_threads<std::vector<T>, microseconds, FilledRandom, ForkJoinChaseLev>("chase-lev", size, threads));
+        series.emplace_back("locked deque", bench_threads<std::vector<T>, microseconds, FilledRandom, ForkJoinLocked>("locked deque", size, threads));
+        scaling_graphs<T>(name() + " fork-join sum", threads, series);
+    }
+};
+
+template<typename T>
+struct bench_concurrent_map {
+    static const std::string name() { return "concurrent_map"; }
+    static void run(){
+        const std::size_t size = 100000;
+        const auto threads = thread_counts();
+
+        new_graph<T>(name() + " 95% reads", "us", "Number of threads");
+        mixes<ReadHeavy>(size, threads);
+        new_graph<T>(name() + " 50% reads", "us", "Number of threads");
+        mixes<Balanced>(size, threads);
+        new_graph<T>(name() + " 5% reads", "us", "Number of threads");
+        mixes<WriteHeavy>(size, threads);
+    }
+
+    template<template<class> class Mix>
+    static void mixes(std::size_t size, const std::vector<std::size_t> &threads){
+        bench_threads<maps::locked_map<T, std::mutex>,        microseconds, FilledMap, Mix>("mutex",        size, threads);
+        bench_threads<maps::locked_map<T, std::shared_mutex>, microseconds, FilledMap, Mix>("shared_mutex", size, threads);
+        bench_threads<maps::striped_map<T>,                   microseconds, FilledMap, Mix>("striped",      size, threads);
+
+        // values are copied optimistically, only for trivially copyable types
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            bench_threads<maps::open_addressing_map<T>,       microseconds, FilledMap, Mix>("lock-free",    size, threads);
+        }
+    }
+};
+
+template<typename T>
+struct bench_concurrent_allocation {
+    static const std::string name() { return "concurrent_allocation"; }
+    static void run(){
+        const std::size_t size = 100000;
+
+        // from one thread to the number of cores
+        std::vector<std::size_t> threads;
+        for(std::size_t n = 1; n <= std::max(1u, std::thread::hardware_concurrency()); ++n)
+            threads.push_back(n);
+
+        new_graph<T>(name() + " fill_back", "K elements/s", "Number of threads");
+        bench_concurrent<std::vector<T>, Empty, FillBack>("vector", size, threads);
+        bench_concurrent<std::list<T>,   Empty, FillBack>("list",   size, threads);
+        bench_concurrent<std::deque<T>,  Empty, FillBack>("deque",  size, threads);
+        bench_concurrent<std::list<T>,   Empty, FillBack>("list remote free",  size, threads, true);
+        bench_concurrent<std::deque<T>,  Empty, FillBack>("deque remote free", size, threads, true);
+
+        new_graph<T>(name() + " fill_front", "K elements/s", "Number of threads");
+        bench_concurrent<std::list<T>,   Empty, FillFront>("list",   size, threads);
+        bench_concurrent<std::forward_list<T>, Empty, FillFront>("forward_list", size, threads);
+        bench_concurrent<std::deque<T>,  Empty, FillFront>("deque",  size, threads);
+        bench_concurrent<std::list<T>,   Empty, FillFront>("list remote free",  size, threads, true);
+        bench_concurrent<std::forward_list<T>, Empty, FillFront>("forward_list remote free", size, threads, true);
+        bench_concurrent<std::deque<T>,  Empty, FillFront>("deque remote free", size, threads, true);
+
+        new_graph<T>(name() + " destruction", "K elements/s", "Number of threads");
+        bench_concurrent<std::vector<T>, Filled, NoOp>("vector", size, threads);
+        bench_concurrent<std::list<T>,   Filled, NoOp>("list",   size, threads);
+        bench_concurrent<std::forward_list<T>, Filled, NoOp>("forward_list", size, threads);
+        bench_concurrent<std::deque<T>,  Filled, NoOp>("deque",  size, threads);
+        bench_concurrent<std::list<T>,   Filled, NoOp>("list remote free",  size, threads, true);
+        bench_concurrent<std::forward_list<T>, Filled, NoOp>("forward_list remote free", size, threads, true);
+        bench_concurrent<std::deque<T>,  Filled, NoOp>("deque remote free", size, threads, true);
+    }
+};
+
+template<typename T>
+struct bench_replay {
+    static const std::string name() { return "replay"; }
+    static void run(){
+        new_graph<T>(name(), "us");
+
+        // the synthetic trace is replayed on several initial sizes
+        std::vector<std::size_t> sizes{1000, 10000, 100000};
+        if(trace::from_file()){
+            sizes = {trace::current().initial()};
+        }
+
+        bench<std::vector<T>, microseconds, FilledTrace, Replay>("vector", sizes);
+        bench<std::list<T>,   microseconds, FilledTrace, Replay>("list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledTrace, Replay>("deque",  sizes);
+
+        // forward_list replays the push_back operations as push_front
+        trace::prepare(sizes.front());
+        auto &workload = trace::current();
+        bool pushes_back = std::any_of(workload.begin(), workload.end(), [](const auto &r){ return r.operation == trace::op::PUSH_BACK; });
+        bench<std::forward_list<T>, microseconds, FilledTrace, Replay>(pushes_back ? "forward_list push_back as push_front" : "forward_list", sizes);
+    }
+};
+
+template<typename T>
+struct bench_tail_latency {
+    static const std::string name() { return "tail_latency"; }
+    static void run(){
+        const std::size_t fill_size = 1000000;
+        const std::size_t size = 100000;
+
+        new_graph<T>(name() + " fill_back", "ns", "Percentile (per mille)");
+        bench_latency<std::vector<T>, Empty, TimedFillBack>("vector", fill_size);
+        bench_latency<std::vector<T>, Empty, ReserveSize, TimedFillBack>("vector reserve", fill_size);
+        bench_latency<std::list<T>,   Empty, TimedFillBack>("list",   fill_size);
+        bench_latency<std::deque<T>,  Empty, TimedFillBack>("deque",  fill_size);
+
+        new_graph<T>(name() + " emplace_back", "ns", "Percentile (per mille)");
+        bench_latency<std::vector<T>, Empty, TimedEmplaceBack>("vector", fill_size);
+        bench_latency<std::vector<T>, Empty, ReserveSize, TimedEmplaceBack>("vector reserve", fill_size);
+        bench_latency<std::list<T>,   Empty, TimedEmplaceBack>("list",   fill_size);
+        bench_latency<std::deque<T>,  Empty, TimedEmplaceBack>("deque",  fill_size);
+
+        new_graph<T>(name() + " fill_front", "ns", "Percentile (per mille)");
+        // it is too slow with bigger data types
+        if(is_small<T>()){
+            bench_latency<std::vector<T>, Empty, TimedFillFront>("vector", size);
+        }
+        bench_latency<std::list<T>,   Empty, TimedFillFront>("list",   size);
+        bench_latency<std::forward_list<T>, Empty, TimedFillFront>("forward_list", size);
+        bench_latency<std::deque<T>,  Empty, TimedFillFront>("deque",  size);
+
+        new_graph<T>(name() + " erase_front", "ns", "Percentile (per mille)");
+        bench_latency<std::vector<T>, FilledRandom, TimedEraseFront>("vector", size);
+        bench_latency<std::list<T>,   FilledRandom, TimedEraseFront>("list",   size);
+        bench_latency<std::forward_list<T>, FilledRandom, TimedEraseFront>("forward_list", size);
+        bench_latency<std::deque<T>,  FilledRandom, TimedEraseFront>("deque",  size);
+
+        new_graph<T>(name() + " erase_middle", "ns", "Percentile (per mille)");
+        bench_latency<std::vector<T>, FilledRandom, TimedEraseMiddle>("vector", size);
+        bench_latency<std::list<T>,   FilledRandom, TimedEraseMiddle>("list",   size);
+        bench_latency<std::forward_list<T>, FilledRandom, TimedEraseMiddle>("forward_list", size);
+        bench_latency<std::deque<T>,  FilledRandom, TimedEraseMiddle>("deque",  size);
+
+        new_graph<T>(name() + " erase_back", "ns", "Percentile (per mille)");
+        bench_latency<std::vector<T>, FilledRandom, TimedEraseBack>("vector", size);
+        bench_latency<std::list<T>,   FilledRandom, TimedEraseBack>("list",   size);
+        bench_latency<std::forward_list<T>, FilledRandom, TimedEraseBack>("forward_list", size);
+        bench_latency<std::deque<T>,  FilledRandom, TimedEraseBack>("deque",  size);
+    }
+};
+
+template<typename T>
+struct bench_heaps {
+    static const std::string name() { return "heaps"; }
+
+    using vector_heap = std::priority_queue<T, std::vector<T>, heaps::greater>;
+    using deque_heap  = std::priority_queue<T, std::deque<T>, heaps::greater>;
+    using four_heap   = heaps::dary_heap<T, 4>;
+    using eight_heap  = heaps::dary_heap<T, 8>;
+    using pairing     = heaps::pairing_heap<T>;
+    using radix       = heaps::radix_heap<T>;
+
+    static void run(){
+        auto sizes = { 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000 };
+
+        new_graph<T>(name() + " push", "us");
+        all<HeapKeys, HeapPush>(sizes);
+
+        new_graph<T>(name() + " pop", "us");
+        all<FilledHeap, HeapPop>(sizes);
+
+        new_graph<T>(name() + " push_pop", "us");
+        all<FilledHeap, HeapPushPop>(sizes);
+
+        // only the pairing heap has decrease-key, the others push the
+        // decreased element again
+        new_graph<T>(name() + " decrease_key", "us");
+        all<FilledHeap, HeapDecreaseKey>(sizes);
+
+        new_graph<T>(name() + " heapify", "us");
+        all<HeapKeys, Heapify>(sizes);
+    }
+
+    template<template<class> class Create, template<class> class Test, typename Sizes>
+    static void all(const Sizes &sizes){
+        bench<vector_heap, microseconds, Create, Test>("priority_queue vector", sizes);
+        bench<deque_heap,  microseconds, Create, Test>("priority_queue deque",  sizes);
+        bench<four_heap,   microseconds, Create, Test>("4-ary heap",            sizes);
+        bench<eight_heap,  microseconds, Create, Test>("8-ary heap",            sizes);
+        bench<pairing,     microseconds, Create, Test>("pairing heap",          sizes);
+        bench<radix,       microseconds, Create, Test>("radix heap",            sizes);
+    }
+};
+
+template<typename T>
+struct bench_lru {
+    static const std::string name() { return "lru"; }
+    static void run(){
+        // the values are the benchmarked type, over 65536 keys
+        auto capacities = { 256, 512, 1024, 2048, 4096, 8192, 16384 };
+
+        new_graph<T>(name() + " uniform", "us", "Capacity");
+        timed<EmptyCacheUniform, CacheRequestsUniform>(capacities);
+        new_graph<T>(name() + " uniform hit rate", "per mille", "Capacity");
+        hit_rates<EmptyCacheUniform, CacheRequestsUniform>(capacities);
+
+        new_graph<T>(name() + " zipf", "us", "Capacity");
+        timed<EmptyCacheZipf, CacheRequestsZipf>(capacities);
+        new_graph<T>(name() + " zipf hit rate", "per mille", "Capacity");
+        hit_rates<EmptyCacheZipf, CacheRequestsZipf>(capacities);
+    }
+
+    template<template<class> class Create, template<class> class Requests, typename Sizes>
+    static void timed(const Sizes &capacities){
+        bench<lru::list_cache<T>,      microseconds, Create, Requests>("list + unordered_map", capacities);
+        bench<lru::intrusive_cache<T>, microseconds, Create, Requests>("intrusive",            capacities);
+        bench<lru::clock_cache<T>,     microseconds, Create, Requests>("clock",                capacities);
+        bench<lru::segmented_cache<T>, microseconds, Create, Requests>("segmented",            capacities);
+    }
+
+    template<template<class> class Create, template<class> class Requests, typename Sizes>
+    static void hit_rates(const Sizes &capacities){
+        bench_hit_rate<lru::list_cache<T>,      Create, Requests>("list + unordered_map", capacities);
+        bench_hit_rate<lru::intrusive_cache<T>, Create, Requests>("intrusive",            capacities);
+        bench_hit_rate<lru::clock_cache<T>,     Create, Requests>("clock",                capacities);
+        bench_hit_rate<lru::segmented_cache<T>, Create, Requests>("segmented",            capacities);
     }
 };
 
@@ -651,12 +1416,16 @@ void bench_fast(std::set<std::string> const& enabled){
     bench_types<bench_fastest_addition,       Types...>(enabled);
     bench_types<bench_fill_front,             Types...>(enabled);
     bench_types<bench_fill_back,              Types...>(enabled);
+    bench_types<bench_growth,                 Types...>(enabled);
     bench_types<bench_emplace_back,           Types...>(enabled);
+    bench_types<bench_bulk_fill,              Types...>(enabled);
     bench_types<bench_emplace_front,          Types...>(enabled);
     bench_types<bench_linear_search,          Types...>(enabled);
+    bench_types<bench_sorted_search,          Types...>(enabled);
     bench_types<bench_traversal,              Types...>(enabled);
     bench_types<bench_traversal_and_clear,    Types...>(enabled);
     bench_types<bench_write,                  Types...>(enabled);
+    bench_types<bench_access,                 Types...>(enabled);
     bench_types<bench_random_insert,          Types...>(enabled);
     bench_types<bench_random_remove,          Types...>(enabled);
     bench_types<bench_erase_front,            Types...>(enabled);
@@ -672,11 +1441,23 @@ void bench_fast(std::set<std::string> const& enabled){
     bench_types<bench_erase_back_value,       Types...>(enabled);
     bench_types<bench_erase_back_value_swap,  Types...>(enabled);
     bench_types<bench_destruction,            Types...>(enabled);
+    bench_types<bench_copy_move,              Types...>(enabled);
     bench_types<bench_erase_1,                Types...>(enabled);
     bench_types<bench_erase_10,               Types...>(enabled);
     bench_types<bench_erase_25,               Types...>(enabled);
     bench_types<bench_erase_50,               Types...>(enabled);
     bench_types<bench_full_erase,             Types...>(enabled);
+    bench_types<bench_parallel_traversal,     Types...>(enabled);
+    bench_types<bench_parallel_write,         Types...>(enabled);
+    bench_types<bench_queues,                 Types...>(enabled);
+    bench_types<bench_work_stealing,          Types...>(enabled);
+    bench_types<bench_concurrent_map,         Types...>(enabled);
+    bench_types<bench_concurrent_allocation,  Types...>(enabled);
+    bench_types<bench_replay,                 Types...>(enabled);
+    bench_types<bench_tail_latency,           Types...>(enabled);
+    bench_types<bench_heaps,                  Types...>(enabled);
+    bench_types<bench_lru,                    Types...>(enabled);
+    bench_types<bench_algorithms,             Types...>(enabled);
 }
 
 template<typename ...Types>
@@ -684,9 +1465,11 @@ void bench_all(std::set<std::string> const& enabled){
     bench_fast<Types...>(enabled);
 
     bench_types<bench_sort,             Types...>(enabled);
+    bench_types<bench_parallel_sort,    Types...>(enabled);
 
     // The following are really slow so run only for limited set of data
     bench_types<bench_find,             TrivialSmall, TrivialMedium, TrivialLarge>(enabled);
+    bench_types<bench_parallel_find,    TrivialSmall, TrivialMedium, TrivialLarge>(enabled);
     bench_types<bench_number_crunching, TrivialSmall, TrivialMedium>(enabled);
 }
 
@@ -709,6 +1492,13 @@ int main(){
     auto enabled = env_options("BENCH_NAMES");
     auto bench_types = env_options("BENCH_TYPES");
 
+    aging::configure(getenv("BENCH_AGING"));
+    distributions::configure(getenv("BENCH_DIST"));
+    cache_state::configure(getenv("BENCH_CACHE"));
+
+    if (!trace::configure(getenv("BENCH_TRACE"), getenv("BENCH_TRACE_MIX"), 10000))
+        return 1;
+
     if (bench_types.size() == 1 && bench_types.count("full")) {
         //Launch all the graphs
         bench_all<
@@ -0,0 +1,164 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <utility>
+
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BENCH_HAVE_CLFLUSH
+#endif
+
+#include "cache_state.hpp"
+
+namespace {
+
+constexpr std::size_t line = 64;
+
+// used when the size of the last level cache is unknown
+constexpr std::size_t default_cache_size = 32 * 1024 * 1024;
+
+std::vector<cache_state::mode> selected_modes{cache_state::mode::AS_BUILT};
+cache_state::mode selected = cache_state::mode::AS_BUILT;
+
+std::vector<unsigned char> buffer;
+
+std::set<std::pair<std::string, cache_state::mode>> warned;
+
+volatile unsigned char sink;
+
+std::size_t last_level_cache_size(){
+    long size = -1;
+
+#ifdef _SC_LEVEL4_CACHE_SIZE
+    size = std::max(size, sysconf(_SC_LEVEL4_CACHE_SIZE));
+#endif
+#ifdef _SC_LEVEL3_CACHE_SIZE
+    size = std::max(size, sysconf(_SC_LEVEL3_CACHE_SIZE));
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    size = std::max(size, sysconf(_SC_LEVEL2_CACHE_SIZE));
+#endif
+
+    return size > 0 ? size : default_cache_size;
+}
+
+} //end of anonymous namespace
+
+void cache_state::configure(const char *spec){
+    std::string value = spec ? spec : "";
+
+    if(value.empty() || value == "off"){
+        selected_modes = {mode::AS_BUILT};
+    } else if(value == "cold"){
+        selected_modes = {mode::COLD};
+    } else if(value == "warm"){
+        selected_modes = {mode::WARM};
+    } else if(value == "both"){
+        selected_modes = {mode::COLD, mode::WARM};
+    } else if(value == "clflush"){
+#ifdef BENCH_HAVE_CLFLUSH
+        selected_modes = {mode::CLFLUSH};
+#else
+        std::cerr << "clflush is not available, the caches are evicted instead" << std::endl;
+        selected_modes = {mode::COLD};
+#endif
+    } else {
+        std::cerr << "Unknown cache mode " << value << std::endl;
+        selected_modes = {mode::AS_BUILT};
+    }
+
+    selected = selected_modes.front();
+}
+
+const std::vector<cache_state::mode> &cache_state::modes(){
+    return selected_modes;
+}
+
+std::string cache_state::suffix(mode m){
+    if(selected_modes.size() < 2){
+        return "";
+    }
+
+    switch(m){
+        case mode::COLD:
+            return " cold";
+        case mode::CLFLUSH:
+            return " clflush";
+        case mode::WARM:
+            return " warm";
+        case mode::AS_BUILT:
+        default:
+            return "";
+    }
+}
+
+void cache_state::select(mode m){
+    selected = m;
+}
+
+cache_state::mode cache_state::current(){
+    return selected;
+}
+
+void cache_state::evict(){
+    if(buffer.empty()){
+        buffer.resize(2 * last_level_cache_size());
+    }
+
+    // each line of the buffer is written, replacing the lines of the container
+    for(std::size_t i = 0; i < buffer.size(); i += line){
+        ++buffer[i];
+    }
+}
+
+void cache_state::flush(const void *address, std::size_t bytes){
+#ifdef BENCH_HAVE_CLFLUSH
+    auto first = reinterpret_cast<std::uintptr_t>(address) & ~(line - 1);
+    auto last = reinterpret_cast<std::uintptr_t>(address) + bytes;
+
+    for(auto i = first; i < last; i += line){
+        _mm_clflush(reinterpret_cast<const void *>(i));
+    }
+#else
+    (void) address;
+    (void) bytes;
+#endif
+}
+
+void cache_state::fence(){
+#ifdef BENCH_HAVE_CLFLUSH
+    _mm_mfence();
+#endif
+}
+
+void cache_state::touch(const void *address, std::size_t bytes){
+    auto bytes_of = static_cast<const volatile unsigned char *>(address);
+
+    unsigned char sum = 0;
+    for(std::size_t i = 0; i < bytes; i += line){
+        sum += bytes_of[i];
+    }
+    sum += bytes_of[bytes - 1];
+
+    sink = sum;
+}
+
+void cache_state::unwalkable(const std::string &container, mode m){
+    if(warned.insert({container, m}).second){
+        if(m == mode::WARM){
+            std::cerr << "Warning: " << container << " cannot be walked, it is left as built instead of warm" << std::endl;
+        } else {
+            std::cerr << "Warning: " << container << " cannot be walked, it is evicted with the buffer instead of clflush" << std::endl;
+        }
+    }
+}
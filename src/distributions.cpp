@@ -0,0 +1,63 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <cstdlib>
+#include <iostream>
+
+#include "distributions.hpp"
+
+namespace {
+
+distributions::config settings;
+
+} //end of anonymous namespace
+
+distributions::config distributions::parse(const char *spec){
+    config parsed;
+    if(!spec || !*spec){
+        return parsed;
+    }
+
+    std::string value(spec);
+    auto colon = value.find(':');
+    auto name = value.substr(0, colon);
+    bool has_parameter = colon != std::string::npos;
+    double parameter = has_parameter ? std::strtod(value.c_str() + colon + 1, nullptr) : 0.0;
+
+    if(name == "uniform"){
+        parsed.distribution = kind::UNIFORM;
+    } else if(name == "zipf"){
+        parsed.distribution = kind::ZIPF;
+        parsed.parameter = has_parameter ? parameter : 0.99;
+    } else if(name == "hotspot"){
+        parsed.distribution = kind::HOTSPOT;
+        parsed.parameter = has_parameter ? parameter : 0.1;
+    } else if(name == "window"){
+        parsed.distribution = kind::WINDOW;
+        parsed.parameter = has_parameter ? parameter : 0.01;
+    } else {
+        std::cerr << "Unknown key distribution " << name << ", the policies keep their own keys" << std::endl;
+        return parsed;
+    }
+
+    if(parsed.parameter < 0.0 || (parsed.distribution != kind::ZIPF && parsed.parameter > 1.0)){
+        std::cerr << "Invalid parameter for the key distribution " << name << ", the policies keep their own keys" << std::endl;
+        return config();
+    }
+
+    parsed.enabled = true;
+    parsed.name = value;
+    return parsed;
+}
+
+void distributions::configure(const char *spec){
+    settings = parse(spec);
+}
+
+const distributions::config &distributions::current(){
+    return settings;
+}
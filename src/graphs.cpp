@@ -16,8 +16,8 @@
 std::shared_ptr<graphs::graph> current_graph;
 std::vector<std::shared_ptr<graphs::graph>> all_graphs;
 
-void graphs::new_graph(const std::string& graph_name, const std::string& graph_title, const std::string& unit){
-    current_graph = std::make_shared<graph>(graph_name, graph_title, unit);
+void graphs::new_graph(const std::string& graph_name, const std::string& graph_title, const std::string& unit, const std::string& h_title){
+    current_graph = std::make_shared<graph>(graph_name, graph_title, unit, h_title);
     all_graphs.push_back(current_graph);
 
     std::cout << "Start " << graph_name << std::endl;
@@ -100,7 +100,7 @@ void graphs::output(Output output){
                  << "title: \"" << graph->title << "\","
                  << "animation: {duration:1200, easing:\"in\"},"
                  << "width: 700, height: 400,"
-                 << "hAxis: {title:\"Number of elements\", slantedText:true},"
+                 << "hAxis: {title:\"" << graph->h_title << "\", slantedText:true},"
                  << "vAxis: {viewWindow: {min:0}, title:\"" << graph->unit << "\"}};" << std::endl
                  << "graph.draw(data, options);" << std::endl;
 
@@ -146,7 +146,7 @@ void graphs::output(Output output){
         //One function to rule them all
         for(auto& graph : all_graphs){
             file << "[line_chart width=\"700px\" height=\"400px\" scale_button=\"true\" title=\"" << graph->title
-                << "\" h_title=\"Number of elements\" v_title=\"" << graph->unit << "\"]" << std::endl;
+                << "\" h_title=\"" << graph->h_title << "\" v_title=\"" << graph->unit << "\"]" << std::endl;
 
             //['x', 'Cats', 'Blanket 1', 'Blanket 2'],
             auto results = compute_values(graph);
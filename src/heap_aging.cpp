@@ -0,0 +1,165 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "heap_aging.hpp"
+
+namespace {
+
+aging::config settings;
+
+// long-lived blocks, kept for the whole run
+std::vector<void *> survivors;
+
+std::mt19937 generator;
+
+std::size_t block_size(){
+    const auto &c = settings;
+
+    switch(c.distribution){
+        case aging::sizes::UNIFORM:
+            return std::uniform_int_distribution<std::size_t>(c.min_size, c.max_size)(generator);
+        case aging::sizes::POW2: {
+            std::size_t lo = std::ceil(std::log2(c.min_size));
+            std::size_t hi = std::floor(std::log2(c.max_size));
+            return std::size_t(1) << std::uniform_int_distribution<std::size_t>(lo, std::max(lo, hi))(generator);
+        }
+        case aging::sizes::LOG:
+        default: {
+            std::uniform_real_distribution<double> exponent(std::log(c.min_size), std::log(c.max_size));
+            return static_cast<std::size_t>(std::exp(exponent(generator)));
+        }
+    }
+}
+
+void *allocate(){
+    auto size = block_size();
+    void *block = std::malloc(size);
+    // touch the block so that its pages are really used
+    std::memset(block, 0, std::min<std::size_t>(size, 64));
+    return block;
+}
+
+} //end of anonymous namespace
+
+void aging::configure(const char *spec){
+    if(!spec || !*spec || std::string(spec) == "off" || std::string(spec) == "0"){
+        settings.enabled = false;
+        return;
+    }
+
+    settings.enabled = true;
+
+    std::stringstream options(spec);
+    std::string option;
+    while(std::getline(options, option, ',')){
+        auto equal = option.find('=');
+        if(equal == std::string::npos){
+            continue;
+        }
+
+        auto key = option.substr(0, equal);
+        auto value = option.substr(equal + 1);
+        auto number = std::strtoull(value.c_str(), nullptr, 10);
+
+        if(key == "churn"){
+            settings.churn = number;
+        } else if(key == "live"){
+            settings.live = number;
+        } else if(key == "lifetime"){
+            settings.lifetime = std::max<std::size_t>(number, 1);
+        } else if(key == "long"){
+            settings.long_lived = std::min<std::size_t>(number, 100);
+        } else if(key == "min"){
+            settings.min_size = std::max<std::size_t>(number, 1);
+        } else if(key == "max"){
+            settings.max_size = number;
+        } else if(key == "sizes"){
+            if(value == "uniform"){
+                settings.distribution = sizes::UNIFORM;
+            } else if(value == "pow2"){
+                settings.distribution = sizes::POW2;
+            } else {
+                settings.distribution = sizes::LOG;
+            }
+        } else {
+            std::cerr << "Unknown heap aging option " << key << std::endl;
+        }
+    }
+
+    settings.max_size = std::max(settings.max_size, settings.min_size);
+}
+
+const aging::config &aging::current(){
+    return settings;
+}
+
+void aging::precondition(){
+    if(!settings.enabled){
+        return;
+    }
+
+    survivors.resize(settings.live, nullptr);
+
+    // a random slot of the window is replaced on each allocation, so the
+    // lifetime of short-lived blocks is geometric with the window size as mean
+    std::vector<void *> window(settings.lifetime, nullptr);
+    std::uniform_int_distribution<std::size_t> window_slot(0, window.size() - 1);
+    std::uniform_int_distribution<std::size_t> percent(0, 99);
+
+    for(std::size_t i = 0; i < settings.churn; ++i){
+        void **slot;
+        if(!survivors.empty() && percent(generator) < settings.long_lived){
+            slot = &survivors[std::uniform_int_distribution<std::size_t>(0, survivors.size() - 1)(generator)];
+        } else {
+            slot = &window[window_slot(generator)];
+        }
+
+        std::free(*slot);
+        *slot = allocate();
+    }
+
+    for(auto block : window){
+        std::free(block);
+    }
+
+    auto heap = stats();
+    if(heap.available){
+        std::cout << "heap: arena " << heap.arena / 1024 << "KiB, in use " << heap.in_use / 1024
+                  << "KiB, free " << heap.free / 1024 << "KiB, fragmentation " << fragmentation(heap) << "%" << std::endl;
+    }
+}
+
+aging::heap_stats aging::stats(){
+    heap_stats heap;
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    auto info = mallinfo2();
+    heap.available = true;
+    heap.arena = info.arena + info.hblkhd;
+    heap.in_use = info.uordblks + info.hblkhd;
+    heap.free = info.fordblks;
+#endif
+
+    return heap;
+}
+
+std::size_t aging::fragmentation(const heap_stats &heap){
+    return heap.arena ? heap.free * 100 / heap.arena : 0;
+}
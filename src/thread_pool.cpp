@@ -0,0 +1,137 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "thread_pool.hpp"
+
+namespace {
+
+// Index of the queue owned by the current thread, the main thread uses 0
+thread_local std::size_t current_queue = 0;
+
+} //end of anonymous namespace
+
+parallel::thread_pool &parallel::thread_pool::instance(){
+    static thread_pool pool;
+    return pool;
+}
+
+parallel::thread_pool::thread_pool(){
+    queues.push_back(std::make_unique<queue>());
+}
+
+parallel::thread_pool::~thread_pool(){
+    stop();
+}
+
+void parallel::thread_pool::stop(){
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for(auto &thread : workers){
+        thread.join();
+    }
+
+    workers.clear();
+    stopping = false;
+}
+
+void parallel::thread_pool::resize(std::size_t threads){
+    if(!threads){
+        threads = 1;
+    }
+
+    if(threads == size()){
+        return;
+    }
+
+    stop();
+
+    queues.clear();
+    for(std::size_t i = 0; i < threads; ++i){
+        queues.push_back(std::make_unique<queue>());
+    }
+
+    for(std::size_t i = 1; i < threads; ++i){
+        workers.emplace_back(&thread_pool::worker, this, i);
+    }
+}
+
+void parallel::thread_pool::submit(std::function<void()> task){
+    auto &own = *queues[current_queue < size() ? current_queue : 0];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.tasks.push_back(std::move(task));
+    }
+
+    pending.fetch_add(1, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+    }
+    wake.notify_one();
+}
+
+bool parallel::thread_pool::pop(std::size_t index, std::function<void()> &task){
+    if(!pending.load(std::memory_order_acquire)){
+        return false;
+    }
+
+    for(std::size_t i = 0; i < size(); ++i){
+        auto &victim = *queues[(index + i) % size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if(victim.tasks.empty()){
+            continue;
+        }
+
+        if(i == 0){
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+        } else {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+
+        pending.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+bool parallel::thread_pool::run_one(){
+    std::function<void()> task;
+    if(!pop(current_queue < size() ? current_queue : 0, task)){
+        return false;
+    }
+
+    task();
+    return true;
+}
+
+void parallel::thread_pool::worker(std::size_t index){
+    current_queue = index;
+
+    std::function<void()> task;
+    while(true){
+        if(pop(index, task)){
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        wake.wait(lock, [this]{ return stopping || pending.load(std::memory_order_acquire); });
+
+        if(stopping){
+            return;
+        }
+    }
+}
@@ -0,0 +1,290 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "trace.hpp"
+
+namespace {
+
+const char magic[4] = {'C', 'T', 'R', 'C'};
+const std::uint32_t version = 1;
+
+const char *names[trace::operations] = {"push_back", "push_front", "insert", "erase", "find", "iterate"};
+
+trace::workload replayed;
+bool mapped_file = false;
+trace::mix synthetic_mix;
+std::size_t synthetic_operations = 0;
+
+std::uint32_t to_position(double fraction){
+    fraction = std::min(std::max(fraction, 0.0), 1.0);
+    return static_cast<std::uint32_t>(std::min(fraction * 4294967296.0, 4294967295.0));
+}
+
+} //end of anonymous namespace
+
+trace::mix trace::parse_mix(const char *spec){
+    mix m;
+    if(!spec || !*spec){
+        return m;
+    }
+
+    std::fill(std::begin(m.weights), std::end(m.weights), 0);
+
+    std::stringstream options(spec);
+    std::string option;
+    while(std::getline(options, option, ',')){
+        auto equal = option.find('=');
+        auto name = option.substr(0, equal);
+        auto weight = equal == std::string::npos ? 0 : std::strtoull(option.c_str() + equal + 1, nullptr, 10);
+
+        auto it = std::find(std::begin(names), std::end(names), name);
+        if(it == std::end(names)){
+            std::cerr << "Unknown trace operation " << name << std::endl;
+            continue;
+        }
+
+        m.weights[it - std::begin(names)] = weight;
+    }
+
+    if(std::all_of(std::begin(m.weights), std::end(m.weights), [](std::size_t w){ return w == 0; })){
+        std::cerr << "Empty trace mix, using the default one" << std::endl;
+        return mix();
+    }
+
+    return m;
+}
+
+trace::workload::~workload(){
+    unmap();
+}
+
+void trace::workload::unmap(){
+    if(mapping){
+        munmap(mapping, mapping_bytes);
+        mapping = nullptr;
+        mapping_bytes = 0;
+    }
+}
+
+void trace::workload::own(){
+    unmap();
+    records = owned.data();
+    count = owned.size();
+}
+
+bool trace::workload::map(const std::string &path){
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0){
+        std::cerr << "Cannot open trace " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) || static_cast<std::size_t>(st.st_size) < sizeof(header)){
+        std::cerr << "Invalid trace " << path << std::endl;
+        close(fd);
+        return false;
+    }
+
+    void *memory = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if(memory == MAP_FAILED){
+        std::cerr << "Cannot map trace " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    auto h = static_cast<const header *>(memory);
+    if(std::memcmp(h->magic, magic, sizeof(magic)) || h->version != version
+            || (st.st_size - sizeof(header)) / sizeof(record) < h->count){
+        std::cerr << "Invalid trace " << path << std::endl;
+        munmap(memory, st.st_size);
+        return false;
+    }
+
+    // the records are read in order
+    madvise(memory, st.st_size, MADV_SEQUENTIAL);
+
+    unmap();
+    owned.clear();
+
+    mapping = memory;
+    mapping_bytes = st.st_size;
+    records = reinterpret_cast<const record *>(h + 1);
+    count = h->count;
+    initial_size = h->initial;
+
+    return true;
+}
+
+bool trace::workload::save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary);
+
+    header h;
+    std::memcpy(h.magic, magic, sizeof(magic));
+    h.version = version;
+    h.initial = initial_size;
+    h.count = count;
+
+    file.write(reinterpret_cast<const char *>(&h), sizeof(h));
+    file.write(reinterpret_cast<const char *>(records), count * sizeof(record));
+
+    if(!file){
+        std::cerr << "Cannot write trace " << path << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool trace::workload::convert(const std::string &text_path){
+    std::ifstream file(text_path);
+    if(!file){
+        std::cerr << "Cannot open trace " << text_path << std::endl;
+        return false;
+    }
+
+    owned.clear();
+    initial_size = 0;
+
+    std::string line;
+    std::size_t number = 0;
+    while(std::getline(file, line)){
+        ++number;
+
+        std::stringstream fields(line);
+        std::string name;
+        if(!(fields >> name) || name[0] == '#'){
+            continue;
+        }
+
+        if(name == "initial"){
+            fields >> initial_size;
+            continue;
+        }
+
+        auto it = std::find(std::begin(names), std::end(names), name);
+        if(it == std::end(names)){
+            std::cerr << text_path << ":" << number << ": unknown operation " << name << std::endl;
+            return false;
+        }
+
+        record r{};
+        r.operation = static_cast<op>(it - std::begin(names));
+
+        double position = 0.0;
+        bool valid = true;
+        switch(r.operation){
+            case op::PUSH_BACK:
+            case op::PUSH_FRONT:
+            case op::FIND:
+                valid = static_cast<bool>(fields >> r.key);
+                break;
+            case op::INSERT:
+                valid = static_cast<bool>(fields >> position >> r.key);
+                break;
+            case op::ERASE:
+                valid = static_cast<bool>(fields >> position);
+                break;
+            case op::ITERATE:
+                break;
+        }
+
+        if(!valid){
+            std::cerr << text_path << ":" << number << ": invalid arguments for " << name << std::endl;
+            return false;
+        }
+
+        r.position = to_position(position);
+        owned.push_back(r);
+    }
+
+    own();
+    return true;
+}
+
+void trace::workload::generate(const mix &m, std::size_t initial, std::size_t operations_count, unsigned seed){
+    std::mt19937 generator(seed);
+    std::discrete_distribution<std::size_t> operation(std::begin(m.weights), std::end(m.weights));
+    std::uniform_int_distribution<std::uint32_t> position;
+
+    // new keys follow the ones of the initial elements, lookups may target
+    // keys which have been erased
+    std::uint64_t next_key = initial;
+
+    owned.clear();
+    owned.reserve(operations_count);
+
+    for(std::size_t i = 0; i < operations_count; ++i){
+        record r{};
+        r.operation = static_cast<op>(operation(generator));
+
+        switch(r.operation){
+            case op::PUSH_BACK:
+            case op::PUSH_FRONT:
+                r.key = next_key++;
+                break;
+            case op::INSERT:
+                r.position = position(generator);
+                r.key = next_key++;
+                break;
+            case op::ERASE:
+                r.position = position(generator);
+                break;
+            case op::FIND:
+                r.key = std::uniform_int_distribution<std::uint64_t>(0, next_key ? next_key - 1 : 0)(generator);
+                break;
+            case op::ITERATE:
+                break;
+        }
+
+        owned.push_back(r);
+    }
+
+    initial_size = initial;
+    own();
+}
+
+bool trace::configure(const char *path, const char *mix_spec, std::size_t operations_count){
+    synthetic_mix = parse_mix(mix_spec);
+    synthetic_operations = operations_count;
+
+    mapped_file = path && *path;
+    if(mapped_file){
+        return replayed.map(path);
+    }
+
+    return true;
+}
+
+const trace::workload &trace::current(){
+    return replayed;
+}
+
+void trace::prepare(std::size_t initial){
+    if(!mapped_file && (!replayed.size() || replayed.initial() != initial)){
+        replayed.generate(synthetic_mix, initial, synthetic_operations);
+    }
+}
+
+bool trace::from_file(){
+    return mapped_file;
+}
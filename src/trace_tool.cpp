@@ -0,0 +1,63 @@
+//=======================================================================
+// Copyright (c) 2014 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "trace.hpp"
+
+// Creation of the binary traces replayed by the replay benchmark
+
+namespace {
+
+int usage(){
+    std::cerr << "Usage: trace_tool convert <text trace> <binary trace>" << std::endl;
+    std::cerr << "       trace_tool generate <binary trace> <initial size> <operations> [mix] [seed]" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "The mix is a list of percentages such as push_back=30,push_front=10,insert=10," << std::endl;
+    std::cerr << "erase=10,find=30,iterate=10 (which is the default one)" << std::endl;
+    return 1;
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char *argv[]){
+    if(argc < 2){
+        return usage();
+    }
+
+    std::string command(argv[1]);
+    trace::workload workload;
+
+    if(command == "convert" && argc == 4){
+        if(!workload.convert(argv[2])){
+            return 1;
+        }
+
+        if(!workload.save(argv[3])){
+            return 1;
+        }
+    } else if(command == "generate" && argc >= 5 && argc <= 7){
+        auto initial = std::strtoull(argv[3], nullptr, 10);
+        auto operations = std::strtoull(argv[4], nullptr, 10);
+        auto mix = trace::parse_mix(argc > 5 ? argv[5] : nullptr);
+        auto seed = argc > 6 ? std::strtoul(argv[6], nullptr, 10) : 0;
+
+        workload.generate(mix, initial, operations, seed);
+
+        if(!workload.save(argv[2])){
+            return 1;
+        }
+    } else {
+        return usage();
+    }
+
+    std::cout << workload.size() << " operations on " << workload.initial() << " initial elements" << std::endl;
+
+    return 0;
+}